@@ -0,0 +1,307 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include "Memory\Memory.hpp"
+
+/*
+* Free indices as one bit each, set while the index is free, with a summary bit per word set while that word has any
+* free bit. GetFree skips full stretches through the summary and returns the lowest free index, so used indices stay
+* packed toward the front
+*
+* GetFree(count) finds the lowest run of count adjacent free indices, runs can cross words. Capacity only grows,
+* Resize adds free indices at the end
+*/
+struct BitFreelist
+{
+public:
+	/// <summary>
+	/// Creates a new BitFreelist instance with no capacity
+	/// </summary>
+	BitFreelist();
+
+	/// <summary>
+	/// Creates a new BitFreelist instance with every index up to capacity free
+	/// </summary>
+	/// <param name="capacity:">The count of indices</param>
+	BitFreelist(U32 capacity);
+
+	BitFreelist(const BitFreelist&) = delete;
+	BitFreelist& operator=(const BitFreelist&) = delete;
+
+	~BitFreelist();
+
+	/// <summary>
+	/// Frees the bitmaps, capacity will be zero
+	/// </summary>
+	void Destroy();
+
+
+
+	/// <summary>
+	/// Grows capacity, the new indices are free
+	/// </summary>
+	/// <param name="capacity:">The new count of indices, nothing happens if it isn't more than the current one</param>
+	void Resize(U32 capacity);
+
+	/// <summary>
+	/// Makes every index free
+	/// </summary>
+	void Reset();
+
+	/// <summary>
+	/// Takes the lowest free index
+	/// </summary>
+	/// <returns>The index, U32_MAX if every index is used</returns>
+	U32 GetFree();
+
+	/// <summary>
+	/// Takes the lowest run of count adjacent free indices
+	/// </summary>
+	/// <param name="count:">The length of the run</param>
+	/// <returns>The first index of the run, U32_MAX if there's no run long enough</returns>
+	U32 GetFree(U32 count);
+
+	/// <summary>
+	/// Makes index free again
+	/// </summary>
+	/// <param name="index:">The index to release</param>
+	void Release(U32 index);
+
+	/// <summary>
+	/// Makes a run of indices free again
+	/// </summary>
+	/// <param name="index:">The first index to release</param>
+	/// <param name="count:">The length of the run</param>
+	void Release(U32 index, U32 count);
+
+
+
+	/// <summary></summary>
+	/// <param name="index:">The index to check</param>
+	/// <returns>true if index is free, false otherwise</returns>
+	bool IsFree(U32 index) const { return words[index >> 6] & (1ull << (index & 63)); }
+
+	/// <summary></summary>
+	/// <returns>true if every index is used, false otherwise</returns>
+	bool Full() const { return freeCount == 0; }
+
+	/// <summary></summary>
+	/// <returns>The count of indices</returns>
+	U32 Capacity() const { return capacity; }
+
+	/// <summary></summary>
+	/// <returns>The count of free indices</returns>
+	U32 FreeCount() const { return freeCount; }
+
+private:
+	void SetRange(U32 index, U32 count, bool free);
+	void UpdateSummary(U32 word);
+	U32 NextWord(U32 word) const;
+
+	U32 WordCount() const { return (capacity + 63) / 64; }
+	U32 SummaryCount() const { return (WordCount() + 63) / 64; }
+
+	/// <summary>
+	/// One bit per index, bits past capacity are always clear
+	/// </summary>
+	U64* words{ nullptr };
+
+	/// <summary>
+	/// One bit per word, set if the word has a free index
+	/// </summary>
+	U64* summary{ nullptr };
+
+	U32 capacity{ 0 };
+	U32 freeCount{ 0 };
+
+	/// <summary>
+	/// No word below this has a free index
+	/// </summary>
+	U32 firstWord{ 0 };
+};
+
+inline BitFreelist::BitFreelist() {}
+
+inline BitFreelist::BitFreelist(U32 capacity) { Resize(capacity); }
+
+inline BitFreelist::~BitFreelist() { Destroy(); }
+
+inline void BitFreelist::Destroy()
+{
+	if (words) { Memory::Free(&words); }
+	if (summary) { Memory::Free(&summary); }
+
+	capacity = 0;
+	freeCount = 0;
+	firstWord = 0;
+}
+
+inline void BitFreelist::Resize(U32 capacity)
+{
+	if (capacity <= this->capacity) { return; }
+
+	U32 oldCapacity = this->capacity;
+	U32 oldWords = WordCount();
+	U32 oldSummaries = SummaryCount();
+
+	this->capacity = capacity;
+
+	U32 wordCount = WordCount();
+	U32 summaryCount = SummaryCount();
+
+	if (wordCount > oldWords)
+	{
+		Memory::Reallocate(&words, wordCount);
+		Memory::Zero(words + oldWords, sizeof(U64) * (wordCount - oldWords));
+	}
+
+	if (summaryCount > oldSummaries)
+	{
+		Memory::Reallocate(&summary, summaryCount);
+		Memory::Zero(summary + oldSummaries, sizeof(U64) * (summaryCount - oldSummaries));
+	}
+
+	Release(oldCapacity, capacity - oldCapacity);
+}
+
+inline void BitFreelist::Reset()
+{
+	U32 wordCount = WordCount();
+
+	Memory::Zero(words, sizeof(U64) * wordCount);
+	Memory::Zero(summary, sizeof(U64) * SummaryCount());
+
+	freeCount = 0;
+	Release(0, capacity);
+}
+
+inline U32 BitFreelist::GetFree()
+{
+	if (!freeCount) { return U32_MAX; }
+
+	U32 word = NextWord(firstWord);
+	firstWord = word;
+
+	U32 index = (word << 6) | (U32)_tzcnt_u64(words[word]);
+
+	words[word] &= words[word] - 1;
+	if (!words[word]) { UpdateSummary(word); }
+	--freeCount;
+
+	return index;
+}
+
+inline U32 BitFreelist::GetFree(U32 count)
+{
+	if (count <= 1) { return count ? GetFree() : U32_MAX; }
+	if (count > freeCount) { return U32_MAX; }
+
+	const U32 wordCount = WordCount();
+	U32 runStart = 0;
+	U32 runLength = 0;
+
+	//A run only carries into the next word when it reaches the word's top bit
+	for (U32 word = NextWord(firstWord); word < wordCount; word = runLength ? word + 1 : NextWord(word + 1))
+	{
+		U64 bits = words[word];
+
+		if (bits == U64_MAX)
+		{
+			if (!runLength) { runStart = word << 6; }
+			runLength += 64;
+		}
+		else
+		{
+			U32 bit = 0;
+
+			while (bit < 64)
+			{
+				U64 shifted = bits >> bit;
+				if (!shifted) { runLength = 0; break; }
+
+				U32 used = (U32)_tzcnt_u64(shifted);
+				if (used) { runLength = 0; bit += used; shifted >>= used; }
+
+				U32 free = (U32)_tzcnt_u64(~shifted);
+				if (!runLength) { runStart = (word << 6) + bit; }
+				runLength += free;
+				bit += free;
+
+				if (runLength >= count) { break; }
+			}
+		}
+
+		if (runLength >= count)
+		{
+			SetRange(runStart, count, false);
+			freeCount -= count;
+			return runStart;
+		}
+	}
+
+	return U32_MAX;
+}
+
+inline void BitFreelist::Release(U32 index)
+{
+	U32 word = index >> 6;
+
+	if (!words[word]) { summary[word >> 6] |= 1ull << (word & 63); }
+	words[word] |= 1ull << (index & 63);
+	++freeCount;
+
+	if (word < firstWord) { firstWord = word; }
+}
+
+inline void BitFreelist::Release(U32 index, U32 count)
+{
+	if (!count) { return; }
+
+	SetRange(index, count, true);
+	freeCount += count;
+
+	if ((index >> 6) < firstWord) { firstWord = index >> 6; }
+}
+
+inline void BitFreelist::SetRange(U32 index, U32 count, bool free)
+{
+	for (U32 i = index, end = index + count; i < end;)
+	{
+		U32 word = i >> 6;
+		U32 bit = i & 63;
+		U32 length = end - i < 64 - bit ? end - i : 64 - bit;
+		U64 mask = (length == 64 ? U64_MAX : (1ull << length) - 1) << bit;
+
+		if (free) { words[word] |= mask; }
+		else { words[word] &= ~mask; }
+
+		UpdateSummary(word);
+		i += length;
+	}
+}
+
+inline void BitFreelist::UpdateSummary(U32 word)
+{
+	U64 bit = 1ull << (word & 63);
+
+	if (words[word]) { summary[word >> 6] |= bit; }
+	else { summary[word >> 6] &= ~bit; }
+}
+
+inline U32 BitFreelist::NextWord(U32 word) const
+{
+	const U32 summaryCount = SummaryCount();
+	U32 index = word >> 6;
+	if (index >= summaryCount) { return WordCount(); }
+
+	U64 mask = summary[index] & (U64_MAX << (word & 63));
+
+	while (!mask)
+	{
+		if (++index >= summaryCount) { return WordCount(); }
+		mask = summary[index];
+	}
+
+	return (index << 6) | (U32)_tzcnt_u64(mask);
+}
\ No newline at end of file
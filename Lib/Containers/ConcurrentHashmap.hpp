@@ -0,0 +1,385 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Math\Hash.hpp"
+#include "Platform\ThreadSafety.hpp"
+
+/*
+* A Hashmap that any thread can use at once, split into ShardCount shards by hash that each have their own lock
+*
+* Writers take their shard's spinlock and bump its sequence before and after changing it. Readers never lock or write,
+* they copy the cell out and retry if the sequence was odd or changed meanwhile, so lookups only slow down while a
+* write to the same shard is happening. Because of that Get and Obtain copy the value out rather than returning a
+* pointer, and keys and values must be plain data that can be read half written. Key a string table by String::Hash()
+*
+* Each shard is a fixed linear probing table, Remove leaves a tombstone and a shard rebuilds itself once tombstones
+* fill it up, which moves its cells. Handles hold part of the key's hash, so one that outlived a Remove or a rebuild
+* fails Obtain
+*/
+template<class Key, class Value, U32 ShardCount = 16>
+struct ConcurrentHashmap
+{
+	static_assert(ShardCount && !(ShardCount & (ShardCount - 1)), "ShardCount must be a power of two");
+	static_assert(!IsDestroyable<Key> && !IsDestroyable<Value>, "Readers copy cells while writers change them, keys and values must be plain data");
+
+public:
+	/// <summary>
+	/// Creates a new ConcurrentHashmap instance with no capacity
+	/// </summary>
+	ConcurrentHashmap();
+
+	/// <summary>
+	/// Creates a new ConcurrentHashmap instance, every shard gets room for its share of capacity
+	/// </summary>
+	/// <param name="capacity:">The count of values to make room for</param>
+	ConcurrentHashmap(U64 capacity);
+
+	~ConcurrentHashmap();
+
+	/// <summary>
+	/// Frees every shard
+	/// WARNING: no other thread may be using the map
+	/// </summary>
+	void Destroy();
+
+	/// <summary>
+	/// Adds key with value, locks key's shard
+	/// </summary>
+	/// <param name="key:">The key to add</param>
+	/// <param name="value:">The value to copy</param>
+	/// <returns>true if key was added, false if it was already there or the shard is full</returns>
+	bool Insert(const Key& key, const Value& value);
+
+	/// <summary>
+	/// Removes key, locks key's shard
+	/// </summary>
+	/// <param name="key:">The key to remove</param>
+	/// <returns>true if key was removed, false if it wasn't there</returns>
+	bool Remove(const Key& key);
+
+	/// <summary>
+	/// Copies key's value out without locking
+	/// </summary>
+	/// <param name="key:">The key to look up</param>
+	/// <param name="value:">Set to key's value if it's found</param>
+	/// <returns>true if key was found, false otherwise</returns>
+	bool Get(const Key& key, Value& value) const;
+
+	/// <summary>
+	/// Finds key's cell without locking, for looking the same key up again without hashing it
+	/// </summary>
+	/// <param name="key:">The key to look up</param>
+	/// <returns>The handle, U64_MAX if key isn't there</returns>
+	HashHandle GetHandle(const Key& key) const;
+
+	/// <summary>
+	/// Copies a handle's value out without locking
+	/// </summary>
+	/// <param name="handle:">A handle from GetHandle</param>
+	/// <param name="value:">Set to the handle's value if it's still good</param>
+	/// <returns>true if the handle's key is still in its cell, false otherwise</returns>
+	bool Obtain(HashHandle handle, Value& value) const;
+
+
+
+	/// <summary></summary>
+	/// <returns>The count of keys, only exact while no thread is writing</returns>
+	U64 Size() const;
+
+	/// <summary></summary>
+	/// <returns>The count of cells across every shard</returns>
+	U64 Capacity() const { return shardCapacity * ShardCount; }
+
+private:
+	static constexpr U8 CELL_EMPTY = 0;
+	static constexpr U8 CELL_FILLED = 1;
+	static constexpr U8 CELL_REMOVED = 2;
+
+	struct Cell
+	{
+		U64 hash;
+		Key key;
+		Value value;
+		U8 state;
+	};
+
+	/// <summary>
+	/// Sequence is odd while a writer is changing cells, the shards are cache line aligned so writers don't share lines
+	/// </summary>
+	struct alignas(64) Shard
+	{
+		volatile U64 sequence;
+		volatile L32 lock;
+		U32 size;
+		U32 removed;
+		Cell* cells;
+	};
+
+	static U64 Hash(const Key& key);
+	Shard& ShardOf(U64 hash) { return shards[(hash >> 32) & (ShardCount - 1)]; }
+	const Shard& ShardOf(U64 hash) const { return shards[(hash >> 32) & (ShardCount - 1)]; }
+	U64 Find(const Shard& shard, U64 hash, const Key& key) const;
+	void Lock(Shard& shard);
+	void Unlock(Shard& shard);
+	void Rebuild(Shard& shard);
+
+	Shard shards[ShardCount]{};
+	U64 shardCapacity{ 0 };
+	U64 shardMask{ 0 };
+
+	ConcurrentHashmap(const ConcurrentHashmap&) = delete;
+	ConcurrentHashmap& operator=(const ConcurrentHashmap&) = delete;
+};
+
+template<class Key, class Value, U32 ShardCount>
+inline ConcurrentHashmap<Key, Value, ShardCount>::ConcurrentHashmap() {}
+
+template<class Key, class Value, U32 ShardCount>
+inline ConcurrentHashmap<Key, Value, ShardCount>::ConcurrentHashmap(U64 capacity)
+{
+	//Each shard stays under three quarters full
+	shardCapacity = 16;
+	while (shardCapacity * 3 / 4 < capacity / ShardCount + 1) { shardCapacity <<= 1; }
+	shardMask = shardCapacity - 1;
+
+	for (Shard& shard : shards)
+	{
+		Memory::AllocateArray(&shard.cells, shardCapacity);
+		Memory::Zero(shard.cells, sizeof(Cell) * shardCapacity);
+	}
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline ConcurrentHashmap<Key, Value, ShardCount>::~ConcurrentHashmap()
+{
+	Destroy();
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline void ConcurrentHashmap<Key, Value, ShardCount>::Destroy()
+{
+	for (Shard& shard : shards)
+	{
+		if (shard.cells) { Memory::Free(&shard.cells); }
+
+		shard.size = 0;
+		shard.removed = 0;
+	}
+
+	shardCapacity = 0;
+	shardMask = 0;
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline bool ConcurrentHashmap<Key, Value, ShardCount>::Insert(const Key& key, const Value& value)
+{
+	if (!shardCapacity) { return false; }
+
+	U64 hash = Hash(key);
+	Shard& shard = ShardOf(hash);
+
+	Lock(shard);
+
+	if (Find(shard, hash, key) != U64_MAX || shard.size + 1 > shardCapacity * 3 / 4) { Unlock(shard); return false; }
+
+	SafeIncrement(&shard.sequence);
+
+	if (shard.size + shard.removed + 1 > shardCapacity * 3 / 4) { Rebuild(shard); }
+
+	//Tombstones are reused, the key isn't further along since Find already missed it
+	U64 i = hash & shardMask;
+	while (shard.cells[i].state == CELL_FILLED) { i = (i + 1) & shardMask; }
+
+	Cell& cell = shard.cells[i];
+	if (cell.state == CELL_REMOVED) { --shard.removed; }
+
+	cell.hash = hash;
+	cell.key = key;
+	cell.value = value;
+	cell.state = CELL_FILLED;
+	++shard.size;
+
+	SafeIncrement(&shard.sequence);
+	Unlock(shard);
+
+	return true;
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline bool ConcurrentHashmap<Key, Value, ShardCount>::Remove(const Key& key)
+{
+	if (!shardCapacity) { return false; }
+
+	U64 hash = Hash(key);
+	Shard& shard = ShardOf(hash);
+
+	Lock(shard);
+
+	U64 i = Find(shard, hash, key);
+
+	if (i != U64_MAX)
+	{
+		SafeIncrement(&shard.sequence);
+
+		shard.cells[i].state = CELL_REMOVED;
+		--shard.size;
+		++shard.removed;
+
+		SafeIncrement(&shard.sequence);
+	}
+
+	Unlock(shard);
+
+	return i != U64_MAX;
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline bool ConcurrentHashmap<Key, Value, ShardCount>::Get(const Key& key, Value& value) const
+{
+	if (!shardCapacity) { return false; }
+
+	U64 hash = Hash(key);
+	const Shard& shard = ShardOf(hash);
+
+	while (true)
+	{
+		U64 sequence = shard.sequence;
+		if (sequence & 1) { _mm_pause(); continue; }
+
+		_ReadWriteBarrier();
+
+		U64 i = Find(shard, hash, key);
+		if (i != U64_MAX) { value = shard.cells[i].value; }
+
+		_ReadWriteBarrier();
+
+		if (shard.sequence == sequence) { return i != U64_MAX; }
+	}
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline HashHandle ConcurrentHashmap<Key, Value, ShardCount>::GetHandle(const Key& key) const
+{
+	if (!shardCapacity) { return U64_MAX; }
+
+	U64 hash = Hash(key);
+	const Shard& shard = ShardOf(hash);
+
+	while (true)
+	{
+		U64 sequence = shard.sequence;
+		if (sequence & 1) { _mm_pause(); continue; }
+
+		_ReadWriteBarrier();
+
+		U64 i = Find(shard, hash, key);
+
+		_ReadWriteBarrier();
+
+		if (shard.sequence != sequence) { continue; }
+		if (i == U64_MAX) { return U64_MAX; }
+
+		//The hash's top half above the cell's index across every shard
+		return (hash & 0xFFFFFFFF00000000ull) | ((U64)(&shard - shards) * shardCapacity + i);
+	}
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline bool ConcurrentHashmap<Key, Value, ShardCount>::Obtain(HashHandle handle, Value& value) const
+{
+	U64 index = handle & 0xFFFFFFFFull;
+	if (handle == U64_MAX || index >= Capacity()) { return false; }
+
+	const Shard& shard = shards[index / shardCapacity];
+	const Cell& cell = shard.cells[index & shardMask];
+
+	while (true)
+	{
+		U64 sequence = shard.sequence;
+		if (sequence & 1) { _mm_pause(); continue; }
+
+		_ReadWriteBarrier();
+
+		bool found = cell.state == CELL_FILLED && (cell.hash & 0xFFFFFFFF00000000ull) == (handle & 0xFFFFFFFF00000000ull);
+		if (found) { value = cell.value; }
+
+		_ReadWriteBarrier();
+
+		if (shard.sequence == sequence) { return found; }
+	}
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline U64 ConcurrentHashmap<Key, Value, ShardCount>::Size() const
+{
+	U64 size = 0;
+	for (const Shard& shard : shards) { size += shard.size; }
+
+	return size;
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline U64 ConcurrentHashmap<Key, Value, ShardCount>::Hash(const Key& key)
+{
+	if constexpr (IsPointer<Key>) { return Hash::Calculate((U64)key); }
+	else { return Hash::Calculate(key); }
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline U64 ConcurrentHashmap<Key, Value, ShardCount>::Find(const Shard& shard, U64 hash, const Key& key) const
+{
+	//Readers can see a half written cell here, whatever they find is thrown away when the sequence doesn't match
+	U64 i = hash & shardMask;
+
+	for (U64 probe = 0; probe < shardCapacity; ++probe, i = (i + 1) & shardMask)
+	{
+		const Cell& cell = shard.cells[i];
+
+		if (cell.state == CELL_EMPTY) { return U64_MAX; }
+		if (cell.state == CELL_FILLED && cell.hash == hash && cell.key == key) { return i; }
+	}
+
+	return U64_MAX;
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline void ConcurrentHashmap<Key, Value, ShardCount>::Lock(Shard& shard)
+{
+	while (SafeCompareAndExchange(&shard.lock, (L32)1, (L32)0) != 0) { _mm_pause(); }
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline void ConcurrentHashmap<Key, Value, ShardCount>::Unlock(Shard& shard)
+{
+	SafeCompareAndExchange(&shard.lock, (L32)0, (L32)1);
+}
+
+template<class Key, class Value, U32 ShardCount>
+inline void ConcurrentHashmap<Key, Value, ShardCount>::Rebuild(Shard& shard)
+{
+	//Only called between sequence bumps, readers retry until it's done
+	Cell* filled;
+	Memory::AllocateArray(&filled, shard.size + 1);
+
+	U32 count = 0;
+	for (U64 i = 0; i < shardCapacity; ++i)
+	{
+		if (shard.cells[i].state == CELL_FILLED) { filled[count++] = shard.cells[i]; }
+	}
+
+	Memory::Zero(shard.cells, sizeof(Cell) * shardCapacity);
+
+	for (U32 j = 0; j < count; ++j)
+	{
+		U64 i = filled[j].hash & shardMask;
+		while (shard.cells[i].state != CELL_EMPTY) { i = (i + 1) & shardMask; }
+
+		shard.cells[i] = filled[j];
+	}
+
+	shard.removed = 0;
+
+	Memory::Free(&filled);
+}
\ No newline at end of file
@@ -0,0 +1,147 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include "StringView.hpp"
+
+template<Character C> struct StringBase;
+
+/// <summary>
+/// Where a placeholder sits in a format string and how its argument is written
+/// </summary>
+struct FormatField
+{
+	U32 offset;
+	U8 length;
+	bool hex;
+	U64 decimals;
+};
+
+/*
+* A format string that's read while compiling, a string literal converts to it only if its placeholders match the
+* arguments, so a wrong count or a placeholder that doesn't fit its argument's type is a compile error
+*
+* Placeholders are {} for any argument, {h} for the hex of a number or pointer, {.} for five decimals of a float and
+* {.N} for N. Any other brace is plain text. Formatting reserves capacity once, the literal text plus the most each
+* fixed size argument can write, then copies text and arguments in one pass without searching
+*/
+template<Character C, typename... Args>
+struct FormatStringBase
+{
+	template<U64 Count>
+	consteval FormatStringBase(const C(&format)[Count]) noexcept;
+
+	/// <summary>
+	/// The format's literal text plus the most every argument can write
+	/// </summary>
+	/// <param name="args:">The arguments, strings and views add their length</param>
+	/// <returns>The count of characters formatting can write, without the null</returns>
+	U64 Capacity(const Args&... args) const noexcept;
+
+	const C* text;
+	U64 length{ 0 };
+
+	/// <summary>
+	/// The literal text plus the most each fixed size argument writes
+	/// </summary>
+	U64 capacity{ 0 };
+
+	FormatField fields[sizeof...(Args) ? sizeof...(Args) : 1]{};
+
+private:
+	template<typename Arg> static consteval bool Hexable() noexcept;
+	template<typename Arg> static U64 ArgumentLength(const Arg& value) noexcept;
+
+	/// <summary>
+	/// Not constexpr, so reaching it while compiling stops the build at the call with reason in the error
+	/// </summary>
+	static void InvalidFormatString(const char* reason) noexcept {}
+};
+
+template<typename... Args> using FormatString = FormatStringBase<C8, TypeIdentity<Args>...>;
+template<typename... Args> using FormatString8 = FormatStringBase<C8, TypeIdentity<Args>...>;
+template<typename... Args> using FormatString16 = FormatStringBase<C16, TypeIdentity<Args>...>;
+template<typename... Args> using FormatString32 = FormatStringBase<C32, TypeIdentity<Args>...>;
+
+template<Character C, typename... Args>
+template<U64 Count>
+inline consteval FormatStringBase<C, Args...>::FormatStringBase(const C(&format)[Count]) noexcept : text{ format }
+{
+	constexpr U64 argumentCount = sizeof...(Args);
+	constexpr bool floats[]{ IsFloatingPoint<Args>..., false };
+	constexpr bool hexable[]{ Hexable<Args>()..., false };
+	constexpr U64 capacities[]{ StringBase<C>::template RequiredCapacity<Args, false>()..., 0 };
+	constexpr U64 hexCapacities[]{ StringBase<C>::template RequiredCapacity<Args, true>()..., 0 };
+
+	while (length < Count && format[length] != StringLookup<C>::NULL_CHAR) { ++length; }
+
+	U64 fieldCount = 0;
+	U64 literalLength = 0;
+
+	for (U64 i = 0; i < length; ++i)
+	{
+		if (format[i] != StringLookup<C>::OPEN_BRACE || i + 1 == length) { ++literalLength; continue; }
+
+		FormatField field{ (U32)i, 0, false, U64_MAX };
+		const C next = format[i + 1];
+		const C after = i + 2 < length ? format[i + 2] : StringLookup<C>::NULL_CHAR;
+
+		if (next == StringLookup<C>::CLOSE_BRACE) { field.length = 2; }
+		else if (next == StringLookup<C>::FMT_HEX && after == StringLookup<C>::CLOSE_BRACE) { field.length = 3; field.hex = true; }
+		else if (next == StringLookup<C>::FMT_DEC && after == StringLookup<C>::CLOSE_BRACE) { field.length = 3; field.decimals = 5; }
+		else if (next == StringLookup<C>::FMT_DEC && after >= StringLookup<C>::ZERO_CHAR && after <= (C)'9' && i + 3 < length && format[i + 3] == StringLookup<C>::CLOSE_BRACE)
+		{
+			field.length = 4;
+			field.decimals = (U64)(after - StringLookup<C>::ZERO_CHAR);
+		}
+		else
+		{
+			//Same as at runtime, the brace and the character after it are text
+			literalLength += 2;
+			++i;
+			continue;
+		}
+
+		if (fieldCount == argumentCount) { InvalidFormatString("More placeholders than arguments"); }
+		if (field.hex && !hexable[fieldCount]) { InvalidFormatString("{h} needs an integer, float or pointer argument"); }
+		if (field.decimals != U64_MAX && !floats[fieldCount]) { InvalidFormatString("{.} and {.N} need a float argument"); }
+
+		capacity += field.hex ? hexCapacities[fieldCount] : capacities[fieldCount];
+		fields[fieldCount++] = field;
+		i += field.length - 1;
+	}
+
+	if (fieldCount != argumentCount) { InvalidFormatString("More arguments than placeholders"); }
+
+	capacity += literalLength;
+}
+
+template<Character C, typename... Args>
+inline U64 FormatStringBase<C, Args...>::Capacity(const Args&... args) const noexcept
+{
+	return (capacity + ... + ArgumentLength(args));
+}
+
+template<Character C, typename... Args>
+template<typename Arg>
+inline consteval bool FormatStringBase<C, Args...>::Hexable() noexcept
+{
+	return IsSigned<Arg> || IsUnsigned<Arg> || IsFloatingPoint<Arg> || (IsPointer<Arg> && !IsStringLiteral<Arg>);
+}
+
+template<Character C, typename... Args>
+template<typename Arg>
+inline U64 FormatStringBase<C, Args...>::ArgumentLength(const Arg& value) noexcept
+{
+	//Fixed size arguments are already in capacity, classes other than strings and views can only grow the string
+	if constexpr (IsStringLiteral<Arg>)
+	{
+		if constexpr (IsPointer<Arg>) { if (!value) { return 0; } }
+
+		U64 length = 0;
+		while (value[length]) { ++length; }
+		return length;
+	}
+	else if constexpr (AnyOf<RemovedQuals<Arg>, StringBase<C8>, StringBase<C16>, StringBase<C32>, StringViewBase<C8>, StringViewBase<C16>, StringViewBase<C32>>) { return value.Size(); }
+	else { return 0; }
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Core\Logger.hpp"
+#include "Vector.hpp"
+
+inline constexpr U64 POOL_HANDLE_NONE = U64_MAX;
+
+/*
+* A Pool whose handles go stale, a handle is the slot's generation above its 32-bit index and every Release bumps the
+* generation, so a handle kept past its Release fails Obtain instead of aliasing whatever reuses the slot
+*
+* Objects live in pages of PageSize that are never moved or freed until Destroy, pointers stay good while the object is
+* alive. A dense list of live slots lets ForEach skip released ones, Release swaps the last live slot into its place.
+* Pools made without grow stop at their starting capacity like Pool does. A slot whose generation runs out is retired
+*/
+template<class Type, U32 PageSize = 256>
+struct HandlePool
+{
+	static_assert(PageSize && !(PageSize & (PageSize - 1)), "PageSize must be a power of two");
+
+public:
+	/// <summary>
+	/// Allocates pages for capacity objects
+	/// </summary>
+	/// <param name="capacity:">The count of objects to make room for</param>
+	/// <param name="grow:">If more pages can be added once capacity is used up</param>
+	void Create(U32 capacity, bool grow = true);
+
+	/// <summary>
+	/// Frees every page, every handle becomes invalid
+	/// </summary>
+	void Destroy();
+
+	/// <summary>
+	/// Gets an unused object, the object is left as it was in memory
+	/// </summary>
+	/// <param name="handle:">Set to the object's handle, POOL_HANDLE_NONE if the pool is full</param>
+	/// <returns>The object, nullptr if the pool is full</returns>
+	Type* Request(U64& handle);
+
+	/// <summary>
+	/// Looks up a handle in O(1)
+	/// </summary>
+	/// <param name="handle:">The handle to look up</param>
+	/// <returns>The object, nullptr if handle was released or never requested</returns>
+	Type* Obtain(U64 handle);
+
+	/// <summary>
+	/// Checks a handle in O(1)
+	/// </summary>
+	/// <param name="handle:">The handle to check</param>
+	/// <returns>true if handle's object hasn't been released, false otherwise</returns>
+	bool Valid(U64 handle) const;
+
+	/// <summary>
+	/// Gives handle's object back to the pool, every copy of handle becomes invalid
+	/// </summary>
+	/// <param name="handle:">The handle to release</param>
+	/// <returns>true if handle was valid, false otherwise</returns>
+	bool Release(U64 handle);
+
+	/// <summary>
+	/// Releases every object, pages are kept
+	/// </summary>
+	void ReleaseAll();
+
+	/// <summary>
+	/// Calls func(U64 handle, Type& object) for every live object, func must not Request or Release
+	/// </summary>
+	/// <param name="func:">The function to call</param>
+	template<typename Func> void ForEach(Func&& func);
+
+
+
+	/// <summary></summary>
+	/// <returns>The count of live objects</returns>
+	U32 Count() const { return (U32)dense.Size(); }
+
+	/// <summary></summary>
+	/// <returns>The count of objects the pool's pages hold</returns>
+	U32 Capacity() const { return (U32)pages.Size() * PageSize; }
+
+	/// <summary></summary>
+	/// <param name="i:">Index in the live objects, less than Count</param>
+	/// <returns>The handle of the live object at i</returns>
+	U64 Handle(U32 i) const { return MakeHandle(dense[i]); }
+
+	/// <summary></summary>
+	/// <param name="i:">Index in the live objects, less than Count</param>
+	/// <returns>The live object at i</returns>
+	Type& operator[](U32 i) { return *Object(dense[i]); }
+
+private:
+	/// <summary>
+	/// A slot's generation and its place in dense, U32_MAX while the slot is free
+	/// </summary>
+	struct Slot
+	{
+		U32 generation;
+		U32 dense;
+	};
+
+	Type* Object(U32 index) { return pages[index / PageSize] + (index & (PageSize - 1)); }
+	U64 MakeHandle(U32 index) const { return ((U64)slots[index].generation << 32) | index; }
+	bool AddPage();
+
+	Vector<Type*> pages;
+	Vector<Slot> slots;
+	Vector<U32> dense;
+	Vector<U32> freeIndices;
+	bool grow{ true };
+};
+
+template<class Type, U32 PageSize>
+inline void HandlePool<Type, PageSize>::Create(U32 capacity, bool grow)
+{
+	this->grow = grow;
+
+	while (Capacity() < capacity) { AddPage(); }
+}
+
+template<class Type, U32 PageSize>
+inline void HandlePool<Type, PageSize>::Destroy()
+{
+	for (Type* page : pages) { Memory::Free(&page); }
+
+	pages.Destroy();
+	slots.Destroy();
+	dense.Destroy();
+	freeIndices.Destroy();
+}
+
+template<class Type, U32 PageSize>
+inline Type* HandlePool<Type, PageSize>::Request(U64& handle)
+{
+	U32 index;
+
+	if (freeIndices.Size()) { freeIndices.Pop(index); }
+	else
+	{
+		if (slots.Size() == Capacity() && (!grow || !AddPage()))
+		{
+			Logger::Error("No Free Resources Left!");
+			handle = POOL_HANDLE_NONE;
+			return nullptr;
+		}
+
+		index = (U32)slots.Size();
+		slots.Push({ 0, U32_MAX });
+	}
+
+	slots[index].dense = (U32)dense.Size();
+	dense.Push(index);
+
+	handle = MakeHandle(index);
+	return Object(index);
+}
+
+template<class Type, U32 PageSize>
+inline Type* HandlePool<Type, PageSize>::Obtain(U64 handle)
+{
+	if (!Valid(handle)) { return nullptr; }
+
+	return Object((U32)handle);
+}
+
+template<class Type, U32 PageSize>
+inline bool HandlePool<Type, PageSize>::Valid(U64 handle) const
+{
+	U32 index = (U32)handle;
+
+	return index < slots.Size() && slots[index].dense != U32_MAX && slots[index].generation == (U32)(handle >> 32);
+}
+
+template<class Type, U32 PageSize>
+inline bool HandlePool<Type, PageSize>::Release(U64 handle)
+{
+	if (!Valid(handle)) { return false; }
+
+	U32 index = (U32)handle;
+	U32 position = slots[index].dense;
+	U32 moved = dense.Back();
+
+	dense[position] = moved;
+	slots[moved].dense = position;
+	dense.Pop();
+
+	slots[index].dense = U32_MAX;
+	if (++slots[index].generation != U32_MAX) { freeIndices.Push(index); }
+
+	return true;
+}
+
+template<class Type, U32 PageSize>
+inline void HandlePool<Type, PageSize>::ReleaseAll()
+{
+	for (U32 index : dense)
+	{
+		slots[index].dense = U32_MAX;
+		if (++slots[index].generation != U32_MAX) { freeIndices.Push(index); }
+	}
+
+	dense.Clear();
+}
+
+template<class Type, U32 PageSize>
+template<typename Func>
+inline void HandlePool<Type, PageSize>::ForEach(Func&& func)
+{
+	for (U32 index : dense) { func(MakeHandle(index), *Object(index)); }
+}
+
+template<class Type, U32 PageSize>
+inline bool HandlePool<Type, PageSize>::AddPage()
+{
+	//Indices have to fit in the handle's low 32 bits
+	if ((U64)Capacity() + PageSize > U32_MAX) { return false; }
+
+	Type* page;
+	Memory::AllocateArray(&page, PageSize);
+	pages.Push(page);
+
+	return true;
+}
\ No newline at end of file
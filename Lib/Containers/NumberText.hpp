@@ -0,0 +1,796 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+/*
+* Numbers to and from decimal text, used by String's ToString and ToType and by StringView's ToType
+*
+* WriteShortest prints the fewest digits that read back to the exact same float with Grisu2, which is the shortest in
+* all but a few cases. ReadFloat rounds correctly, short inputs are exact in one double multiply or divide and the rest
+* start from a double estimate that's stepped an ulp at a time by comparing against the halfway points as big integers.
+* Only the first 19 significant digits are read, more than WriteShortest ever prints
+*
+* Integers are read eight C8 digits at a time out of a U64
+*/
+class NumberText
+{
+public:
+	/// <summary>
+	/// The most characters WriteShortest and WriteFixed write
+	/// </summary>
+	static constexpr U64 FLOAT_TEXT_MAX = 48;
+
+	/// <summary>
+	/// Writes the shortest text that reads back to value, "nan" and "inf" for those
+	/// </summary>
+	/// <param name="text:">Where to write, room for FLOAT_TEXT_MAX characters</param>
+	/// <param name="value:">The number to write</param>
+	/// <returns>The count of characters written, no null is written</returns>
+	template<Character C, FloatingPoint F> static U64 WriteShortest(C* text, F value) noexcept;
+
+	/// <summary>
+	/// Writes value rounded to a count of decimals, values that don't fit a U64 are written shortest
+	/// </summary>
+	/// <param name="text:">Where to write, room for FLOAT_TEXT_MAX characters</param>
+	/// <param name="value:">The number to write</param>
+	/// <param name="decimals:">The count of digits after the decimal point, at most 17</param>
+	/// <returns>The count of characters written, no null is written</returns>
+	template<Character C, FloatingPoint F> static U64 WriteFixed(C* text, F value, U64 decimals) noexcept;
+
+	/// <summary>
+	/// Reads a float like "-12.5", "1e-7", "inf" or "nan" rounded to the nearest F
+	/// </summary>
+	/// <param name="it:">The first character to read</param>
+	/// <param name="end:">One past the last character that may be read</param>
+	/// <param name="value:">Set to the number, 0 if there isn't one</param>
+	/// <returns>One past the last character used, it if there wasn't a number</returns>
+	template<Character C, FloatingPoint F> static const C* ReadFloat(const C* it, const C* end, F& value) noexcept;
+
+	/// <summary>
+	/// Reads digits, wrapping like arithmetic on I does
+	/// </summary>
+	/// <param name="it:">The first character to read</param>
+	/// <param name="end:">One past the last character that may be read</param>
+	/// <param name="value:">Set to the number, 0 if there isn't one</param>
+	/// <returns>One past the last digit</returns>
+	template<Character C, Unsigned I> static const C* ReadUnsigned(const C* it, const C* end, I& value) noexcept;
+
+	/// <summary>
+	/// Reads an optional sign then digits, wrapping like arithmetic on I does
+	/// </summary>
+	/// <param name="it:">The first character to read</param>
+	/// <param name="end:">One past the last character that may be read</param>
+	/// <param name="value:">Set to the number, 0 if there isn't one</param>
+	/// <returns>One past the last digit</returns>
+	template<Character C, Signed I> static const C* ReadSigned(const C* it, const C* end, I& value) noexcept;
+
+private:
+	/// <summary>
+	/// A significand and binary exponent, f * 2^e
+	/// </summary>
+	struct DiyFp
+	{
+		U64 f;
+		I32 e;
+	};
+
+	/// <summary>
+	/// Just wide enough for either side of a halfway comparison, the largest is about 2600 bits with every digit read
+	/// </summary>
+	struct BigInteger
+	{
+		static constexpr U32 WORD_COUNT = 84;
+
+		void MultiplySmall(U32 multiplier) noexcept;
+		void AddSmall(U32 value) noexcept;
+		void MultiplyPow5(U32 power) noexcept;
+		void ShiftLeft(U32 bits) noexcept;
+		static I32 Compare(const BigInteger& a, const BigInteger& b) noexcept;
+
+		U32 words[WORD_COUNT];
+		U32 count;
+	};
+
+	template<FloatingPoint F> static constexpr U32 MANTISSA_BITS = sizeof(F) == 8 ? 52 : 23;
+	template<FloatingPoint F> static constexpr I32 EXPONENT_BIAS = sizeof(F) == 8 ? 1023 : 127;
+	template<FloatingPoint F> static constexpr U64 INFINITY_BITS = sizeof(F) == 8 ? 0x7FF0000000000000ull : 0x7F800000ull;
+
+	template<FloatingPoint F> static U64 ToBits(F value) noexcept;
+	template<FloatingPoint F> static F FromBits(U64 bits) noexcept;
+	template<FloatingPoint F> static DiyFp Decode(U64 bits) noexcept;
+
+	static DiyFp Multiply(DiyFp a, DiyFp b) noexcept;
+	static DiyFp Normalize(DiyFp value) noexcept;
+	static DiyFp CachedPower(I32 e, I32& k) noexcept;
+	template<FloatingPoint F> static U32 Grisu2(F value, C8* digits, I32& k) noexcept;
+	static U32 DigitGen(DiyFp w, DiyFp mp, U64 delta, C8* digits, I32& k) noexcept;
+	static void GrisuRound(C8* digits, U32 length, U64 delta, U64 rest, U64 tenKappa, U64 distance) noexcept;
+
+	template<Character C, FloatingPoint F> static F Compose(U64 mantissa, I32 exponent, bool truncated, const C* digits, const C* digitsEnd) noexcept;
+	template<Character C, FloatingPoint F> static I32 CompareText(U64 mantissa, I32 exponent, bool truncated, const C* digits, const C* digitsEnd, U64 bits) noexcept;
+	template<FloatingPoint F> static I32 CompareHalfway(const BigInteger& digits, I32 exponent, U64 bits) noexcept;
+
+	template<Character C> static bool Digit(C c) noexcept { return c >= (C)'0' && c <= (C)'9'; }
+	static bool EightDigits(U64 chunk) noexcept;
+	static U32 ParseEight(U64 chunk) noexcept;
+
+	static constexpr U64 POW10[20]{
+		1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull, 1000000000ull,
+		10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull, 100000000000000ull, 1000000000000000ull,
+		10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+	};
+
+	static constexpr F64 POW10_F64[23]{
+		1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+		1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+	};
+
+	/// <summary>
+	/// Halfway points between floats have at most 767 significant digits, any past this only tell if the text is above one
+	/// </summary>
+	static constexpr U32 HALFWAY_DIGITS_MAX = 768;
+
+	static constexpr U32 POW5[13]{ 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625 };
+
+	/// <summary>
+	/// 10^k for k from -348 to 340 in steps of 8, rounded to 64 bits
+	/// </summary>
+	static constexpr U64 CACHED_POWERS[87]{
+		0xFA8FD5A0081C0288ull, 0xBAAEE17FA23EBF76ull, 0x8B16FB203055AC76ull, 0xCF42894A5DCE35EAull,
+		0x9A6BB0AA55653B2Dull, 0xE61ACF033D1A45DFull, 0xAB70FE17C79AC6CAull, 0xFF77B1FCBEBCDC4Full,
+		0xBE5691EF416BD60Cull, 0x8DD01FAD907FFC3Cull, 0xD3515C2831559A83ull, 0x9D71AC8FADA6C9B5ull,
+		0xEA9C227723EE8BCBull, 0xAECC49914078536Dull, 0x823C12795DB6CE57ull, 0xC21094364DFB5637ull,
+		0x9096EA6F3848984Full, 0xD77485CB25823AC7ull, 0xA086CFCD97BF97F4ull, 0xEF340A98172AACE5ull,
+		0xB23867FB2A35B28Eull, 0x84C8D4DFD2C63F3Bull, 0xC5DD44271AD3CDBAull, 0x936B9FCEBB25C996ull,
+		0xDBAC6C247D62A584ull, 0xA3AB66580D5FDAF6ull, 0xF3E2F893DEC3F126ull, 0xB5B5ADA8AAFF80B8ull,
+		0x87625F056C7C4A8Bull, 0xC9BCFF6034C13053ull, 0x964E858C91BA2655ull, 0xDFF9772470297EBDull,
+		0xA6DFBD9FB8E5B88Full, 0xF8A95FCF88747D94ull, 0xB94470938FA89BCFull, 0x8A08F0F8BF0F156Bull,
+		0xCDB02555653131B6ull, 0x993FE2C6D07B7FACull, 0xE45C10C42A2B3B06ull, 0xAA242499697392D3ull,
+		0xFD87B5F28300CA0Eull, 0xBCE5086492111AEBull, 0x8CBCCC096F5088CCull, 0xD1B71758E219652Cull,
+		0x9C40000000000000ull, 0xE8D4A51000000000ull, 0xAD78EBC5AC620000ull, 0x813F3978F8940984ull,
+		0xC097CE7BC90715B3ull, 0x8F7E32CE7BEA5C70ull, 0xD5D238A4ABE98068ull, 0x9F4F2726179A2245ull,
+		0xED63A231D4C4FB27ull, 0xB0DE65388CC8ADA8ull, 0x83C7088E1AAB65DBull, 0xC45D1DF942711D9Aull,
+		0x924D692CA61BE758ull, 0xDA01EE641A708DEAull, 0xA26DA3999AEF774Aull, 0xF209787BB47D6B85ull,
+		0xB454E4A179DD1877ull, 0x865B86925B9BC5C2ull, 0xC83553C5C8965D3Dull, 0x952AB45CFA97A0B3ull,
+		0xDE469FBD99A05FE3ull, 0xA59BC234DB398C25ull, 0xF6C69A72A3989F5Cull, 0xB7DCBF5354E9BECEull,
+		0x88FCF317F22241E2ull, 0xCC20CE9BD35C78A5ull, 0x98165AF37B2153DFull, 0xE2A0B5DC971F303Aull,
+		0xA8D9D1535CE3B396ull, 0xFB9B7CD9A4A7443Cull, 0xBB764C4CA7A44410ull, 0x8BAB8EEFB6409C1Aull,
+		0xD01FEF10A657842Cull, 0x9B10A4E5E9913129ull, 0xE7109BFBA19C0C9Dull, 0xAC2820D9623BF429ull,
+		0x80444B5E7AA7CF85ull, 0xBF21E44003ACDD2Dull, 0x8E679C2F5E44FF8Full, 0xD433179D9C8CB841ull,
+		0x9E19DB92B4E31BA9ull, 0xEB96BF6EBADF77D9ull, 0xAF87023B9BF0EE6Bull,
+	};
+
+	static constexpr I16 CACHED_EXPONENTS[87]{
+		-1220, -1193, -1166, -1140, -1113, -1087, -1060, -1034, -1007, -980, -954, -927, -901, -874, -847, -821,
+		-794, -768, -741, -715, -688, -661, -635, -608, -582, -555, -529, -502, -475, -449, -422, -396,
+		-369, -343, -316, -289, -263, -236, -210, -183, -157, -130, -103, -77, -50, -24, 3, 30,
+		56, 83, 109, 136, 162, 189, 216, 242, 269, 295, 322, 348, 375, 402, 428, 455,
+		481, 508, 534, 561, 588, 614, 641, 667, 694, 720, 747, 774, 800, 827, 853, 880,
+		907, 933, 960, 986, 1013, 1039, 1066,
+	};
+
+	STATIC_CLASS(NumberText);
+};
+
+template<Character C, FloatingPoint F>
+inline U64 NumberText::WriteShortest(C* text, F value) noexcept
+{
+	C* it = text;
+	U64 bits = ToBits(value);
+
+	if (bits >> (sizeof(F) * 8 - 1)) { *it++ = StringLookup<C>::NEGATIVE_CHAR; bits &= ~(1ull << (sizeof(F) * 8 - 1)); }
+
+	if (bits >= INFINITY_BITS<F>)
+	{
+		if (bits > INFINITY_BITS<F>) { it = text; *it++ = (C)'n'; *it++ = (C)'a'; *it++ = (C)'n'; }
+		else { *it++ = (C)'i'; *it++ = (C)'n'; *it++ = (C)'f'; }
+
+		return it - text;
+	}
+
+	if (!bits) { *it++ = StringLookup<C>::ZERO_CHAR; return it - text; }
+
+	C8 digits[20];
+	I32 k;
+	const I32 length = (I32)Grisu2(FromBits<F>(bits), digits, k);
+
+	//Where the decimal point goes counting from the first digit, plain up to 21 digits then scientific
+	const I32 point = length + k;
+
+	if (length <= point && point <= 21)
+	{
+		for (I32 i = 0; i < length; ++i) { *it++ = (C)digits[i]; }
+		for (I32 i = length; i < point; ++i) { *it++ = StringLookup<C>::ZERO_CHAR; }
+	}
+	else if (0 < point && point <= 21)
+	{
+		for (I32 i = 0; i < point; ++i) { *it++ = (C)digits[i]; }
+		*it++ = StringLookup<C>::DECIMAL_CHAR;
+		for (I32 i = point; i < length; ++i) { *it++ = (C)digits[i]; }
+	}
+	else if (-6 < point && point <= 0)
+	{
+		*it++ = StringLookup<C>::ZERO_CHAR;
+		*it++ = StringLookup<C>::DECIMAL_CHAR;
+		for (I32 i = point; i < 0; ++i) { *it++ = StringLookup<C>::ZERO_CHAR; }
+		for (I32 i = 0; i < length; ++i) { *it++ = (C)digits[i]; }
+	}
+	else
+	{
+		*it++ = (C)digits[0];
+
+		if (length > 1)
+		{
+			*it++ = StringLookup<C>::DECIMAL_CHAR;
+			for (I32 i = 1; i < length; ++i) { *it++ = (C)digits[i]; }
+		}
+
+		*it++ = (C)'e';
+
+		I32 exponent = point - 1;
+		if (exponent < 0) { *it++ = StringLookup<C>::NEGATIVE_CHAR; exponent = -exponent; }
+
+		if (exponent >= 100) { *it++ = (C)('0' + exponent / 100); exponent %= 100; *it++ = (C)('0' + exponent / 10); }
+		else if (exponent >= 10) { *it++ = (C)('0' + exponent / 10); }
+
+		*it++ = (C)('0' + exponent % 10);
+	}
+
+	return it - text;
+}
+
+template<Character C, FloatingPoint F>
+inline U64 NumberText::WriteFixed(C* text, F value, U64 decimals) noexcept
+{
+	if (!(value < 1e19 && value > -1e19)) { return WriteShortest(text, value); }
+	if (decimals > 17) { decimals = 17; }
+
+	C* it = text;
+	F64 number = (F64)value;
+
+	if (number < 0.0) { *it++ = StringLookup<C>::NEGATIVE_CHAR; number = -number; }
+
+	//Rounded as a whole count of the last decimal, carrying into the whole part
+	U64 whole = (U64)number;
+	U64 fraction = (U64)((number - (F64)whole) * (F64)POW10[decimals] + 0.5);
+	if (fraction >= POW10[decimals]) { ++whole; fraction -= POW10[decimals]; }
+
+	C reversed[20];
+	U32 count = 0;
+
+	do { reversed[count++] = (C)('0' + whole % 10); whole /= 10; } while (whole);
+	while (count) { *it++ = reversed[--count]; }
+
+	if (decimals)
+	{
+		*it++ = StringLookup<C>::DECIMAL_CHAR;
+
+		for (U64 i = decimals; i--;) { it[i] = (C)('0' + fraction % 10); fraction /= 10; }
+		it += decimals;
+	}
+
+	return it - text;
+}
+
+template<Character C, FloatingPoint F>
+inline const C* NumberText::ReadFloat(const C* it, const C* end, F& value) noexcept
+{
+	const C* start = it;
+	bool negative = false;
+
+	value = 0;
+
+	if (it != end && (*it == StringLookup<C>::NEGATIVE_CHAR || *it == StringLookup<C>::POSITIVE_CHAR)) { negative = *it++ == StringLookup<C>::NEGATIVE_CHAR; }
+
+	if (it != end && ((*it | 0x20) == (C)'i' || (*it | 0x20) == (C)'n'))
+	{
+		static constexpr C8 INFINITY_TEXT[] = "infinity";
+		static constexpr C8 NAN_TEXT[] = "nan";
+
+		const C8* word = (*it | 0x20) == (C)'i' ? INFINITY_TEXT : NAN_TEXT;
+		U32 matched = 0;
+
+		while (word[matched] && it + matched != end && (it[matched] | 0x20) == (C)word[matched]) { ++matched; }
+
+		if (word == NAN_TEXT && matched == 3) { value = FromBits<F>(INFINITY_BITS<F> | (1ull << (MANTISSA_BITS<F> - 1))); return it + 3; }
+		if (word == INFINITY_TEXT && (matched == 3 || matched == 8)) { value = negative ? -FromBits<F>(INFINITY_BITS<F>) : FromBits<F>(INFINITY_BITS<F>); return it + matched; }
+
+		return start;
+	}
+
+	U64 mantissa = 0;
+	I32 exponent = 0;
+	U32 significant = 0;
+	bool truncated = false;
+	bool anyDigits = false;
+	const C* digits = it;
+
+	//Past 19 significant digits the rest only move the exponent
+	while (it != end)
+	{
+		if constexpr (sizeof(C) == 1)
+		{
+			if (mantissa && significant <= 11 && end - it >= 8 && EightDigits(*(const U64*)it))
+			{
+				mantissa = mantissa * 100000000 + ParseEight(*(const U64*)it);
+				significant += 8;
+				it += 8;
+				continue;
+			}
+		}
+
+		if (!Digit(*it)) { break; }
+
+		U32 digit = (U32)(*it++ - (C)'0');
+		anyDigits = true;
+
+		if (significant < 19) { mantissa = mantissa * 10 + digit; significant += mantissa != 0; }
+		else { ++exponent; truncated |= digit != 0; }
+	}
+
+	if (it != end && *it == StringLookup<C>::DECIMAL_CHAR)
+	{
+		++it;
+
+		while (it != end)
+		{
+			if constexpr (sizeof(C) == 1)
+			{
+				if (mantissa && significant <= 11 && end - it >= 8 && EightDigits(*(const U64*)it))
+				{
+					mantissa = mantissa * 100000000 + ParseEight(*(const U64*)it);
+					significant += 8;
+					exponent -= 8;
+					it += 8;
+					continue;
+				}
+			}
+
+			if (!Digit(*it)) { break; }
+
+			U32 digit = (U32)(*it++ - (C)'0');
+			anyDigits = true;
+
+			if (significant < 19) { mantissa = mantissa * 10 + digit; significant += mantissa != 0; --exponent; }
+			else { truncated |= digit != 0; }
+		}
+	}
+
+	if (!anyDigits) { return start; }
+
+	const C* digitsEnd = it;
+
+	if (it != end && (*it | 0x20) == (C)'e')
+	{
+		const C* mark = it++;
+		bool negativeExponent = false;
+
+		if (it != end && (*it == StringLookup<C>::NEGATIVE_CHAR || *it == StringLookup<C>::POSITIVE_CHAR)) { negativeExponent = *it++ == StringLookup<C>::NEGATIVE_CHAR; }
+
+		if (it != end && Digit(*it))
+		{
+			I32 written = 0;
+			while (it != end && Digit(*it)) { if (written < 100000) { written = written * 10 + (I32)(*it - (C)'0'); } ++it; }
+
+			exponent += negativeExponent ? -written : written;
+		}
+		else { it = mark; }
+	}
+
+	value = mantissa ? Compose<C, F>(mantissa, exponent, truncated, digits, digitsEnd) : (F)0;
+	if (negative) { value = -value; }
+
+	return it;
+}
+
+template<Character C, Unsigned I>
+inline const C* NumberText::ReadUnsigned(const C* it, const C* end, I& value) noexcept
+{
+	value = 0;
+
+	if constexpr (sizeof(C) == 1)
+	{
+		while (end - it >= 8 && EightDigits(*(const U64*)it))
+		{
+			value = (I)(value * 100000000 + ParseEight(*(const U64*)it));
+			it += 8;
+		}
+	}
+
+	while (it != end && Digit(*it)) { value = (I)(value * 10 + (*it++ - (C)'0')); }
+
+	return it;
+}
+
+template<Character C, Signed I>
+inline const C* NumberText::ReadSigned(const C* it, const C* end, I& value) noexcept
+{
+	using UnsignedType = UnsignedOf<I>;
+
+	bool negative = false;
+	if (it != end && (*it == StringLookup<C>::NEGATIVE_CHAR || *it == StringLookup<C>::POSITIVE_CHAR)) { negative = *it++ == StringLookup<C>::NEGATIVE_CHAR; }
+
+	UnsignedType magnitude;
+	it = ReadUnsigned(it, end, magnitude);
+
+	value = (I)(negative ? (UnsignedType)0 - magnitude : magnitude);
+
+	return it;
+}
+
+template<FloatingPoint F>
+inline U64 NumberText::ToBits(F value) noexcept
+{
+	if constexpr (sizeof(F) == 8) { return reinterpret_cast<const U64&>(value); }
+	else { return reinterpret_cast<const U32&>(value); }
+}
+
+template<FloatingPoint F>
+inline F NumberText::FromBits(U64 bits) noexcept
+{
+	if constexpr (sizeof(F) == 8) { return reinterpret_cast<const F&>(bits); }
+	else { U32 low = (U32)bits; return reinterpret_cast<const F&>(low); }
+}
+
+template<FloatingPoint F>
+inline NumberText::DiyFp NumberText::Decode(U64 bits) noexcept
+{
+	//The infinity pattern decodes as the power of two past the largest float, which halfway comparisons rely on
+	const U64 fraction = bits & ((1ull << MANTISSA_BITS<F>) - 1);
+	const I32 field = (I32)(bits >> MANTISSA_BITS<F>);
+
+	if (field) { return { fraction | (1ull << MANTISSA_BITS<F>), field - EXPONENT_BIAS<F> - (I32)MANTISSA_BITS<F> }; }
+	return { fraction, 1 - EXPONENT_BIAS<F> - (I32)MANTISSA_BITS<F> };
+}
+
+inline NumberText::DiyFp NumberText::Multiply(DiyFp a, DiyFp b) noexcept
+{
+	const U64 mask = 0xFFFFFFFFull;
+	const U64 a1 = a.f >> 32, a0 = a.f & mask;
+	const U64 b1 = b.f >> 32, b0 = b.f & mask;
+	const U64 high = a1 * b1, middle0 = a0 * b1, middle1 = a1 * b0, low = a0 * b0;
+
+	//Rounds the dropped low half
+	const U64 carry = (low >> 32) + (middle0 & mask) + (middle1 & mask) + (1ull << 31);
+
+	return { high + (middle0 >> 32) + (middle1 >> 32) + (carry >> 32), a.e + b.e + 64 };
+}
+
+inline NumberText::DiyFp NumberText::Normalize(DiyFp value) noexcept
+{
+	unsigned long top;
+	_BitScanReverse64(&top, value.f);
+
+	const U32 shift = 63 - (U32)top;
+	return { value.f << shift, value.e - (I32)shift };
+}
+
+inline NumberText::DiyFp NumberText::CachedPower(I32 e, I32& k) noexcept
+{
+	//The power that brings e into [-60, -32], 0.30102999566398114 is log10(2)
+	const F64 dk = (-61 - e) * 0.30102999566398114 + 347;
+	I32 power = (I32)dk;
+	if (dk - power > 0.0) { ++power; }
+
+	const U32 index = (U32)((power >> 3) + 1);
+	k = -(-348 + (I32)(index << 3));
+
+	return { CACHED_POWERS[index], CACHED_EXPONENTS[index] };
+}
+
+template<FloatingPoint F>
+inline U32 NumberText::Grisu2(F value, C8* digits, I32& k) noexcept
+{
+	constexpr U32 significandBits = MANTISSA_BITS<F>;
+	constexpr U64 hiddenBit = 1ull << significandBits;
+
+	const DiyFp v = Decode<F>(ToBits(value));
+
+	//The halfway points to the neighbouring floats, the lower one is closer at a power of two
+	DiyFp plus{ (v.f << 1) + 1, v.e - 1 };
+	while (!(plus.f & (hiddenBit << 1))) { plus.f <<= 1; --plus.e; }
+	plus.f <<= 64 - significandBits - 2;
+	plus.e -= 64 - significandBits - 2;
+
+	DiyFp minus = v.f == hiddenBit ? DiyFp{ (v.f << 2) - 1, v.e - 2 } : DiyFp{ (v.f << 1) - 1, v.e - 1 };
+	minus.f <<= minus.e - plus.e;
+	minus.e = plus.e;
+
+	const DiyFp cached = CachedPower(plus.e, k);
+	const DiyFp w = Multiply(Normalize(v), cached);
+	DiyFp upper = Multiply(plus, cached);
+	DiyFp lower = Multiply(minus, cached);
+
+	//Kept strictly inside the boundaries since the cached power isn't exact
+	++lower.f;
+	--upper.f;
+
+	return DigitGen(w, upper, upper.f - lower.f, digits, k);
+}
+
+inline U32 NumberText::DigitGen(DiyFp w, DiyFp mp, U64 delta, C8* digits, I32& k) noexcept
+{
+	const DiyFp one{ 1ull << -mp.e, mp.e };
+	const U64 distance = mp.f - w.f;
+
+	U32 p1 = (U32)(mp.f >> -one.e);
+	U64 p2 = mp.f & (one.f - 1);
+	I32 kappa = 1;
+	while (kappa < 10 && p1 >= POW10[kappa]) { ++kappa; }
+
+	U32 length = 0;
+
+	while (kappa > 0)
+	{
+		const U32 digit = (U32)(p1 / POW10[kappa - 1]);
+		p1 %= POW10[kappa - 1];
+
+		if (digit || length) { digits[length++] = (C8)('0' + digit); }
+		--kappa;
+
+		const U64 rest = ((U64)p1 << -one.e) + p2;
+
+		if (rest <= delta)
+		{
+			k += kappa;
+			GrisuRound(digits, length, delta, rest, POW10[kappa] << -one.e, distance);
+			return length;
+		}
+	}
+
+	while (true)
+	{
+		p2 *= 10;
+		delta *= 10;
+
+		const C8 digit = (C8)(p2 >> -one.e);
+		if (digit || length) { digits[length++] = (C8)('0' + digit); }
+
+		p2 &= one.f - 1;
+		--kappa;
+
+		if (p2 < delta)
+		{
+			k += kappa;
+			GrisuRound(digits, length, delta, p2, one.f, -kappa < 20 ? distance * POW10[-kappa] : 0);
+			return length;
+		}
+	}
+}
+
+inline void NumberText::GrisuRound(C8* digits, U32 length, U64 delta, U64 rest, U64 tenKappa, U64 distance) noexcept
+{
+	while (rest < distance && delta - rest >= tenKappa && (rest + tenKappa < distance || distance - rest > rest + tenKappa - distance))
+	{
+		--digits[length - 1];
+		rest += tenKappa;
+	}
+}
+
+template<Character C, FloatingPoint F>
+inline F NumberText::Compose(U64 mantissa, I32 exponent, bool truncated, const C* digits, const C* digitsEnd) noexcept
+{
+	constexpr bool isDouble = sizeof(F) == 8;
+
+	//Past these it's infinity or zero whatever the digits
+	if (exponent > (isDouble ? 309 : 39)) { return FromBits<F>(INFINITY_BITS<F>); }
+	if (exponent < (isDouble ? -343 : -65)) { return (F)0; }
+
+	//Both operands exact, so the one rounding is correct
+	if (!truncated)
+	{
+		if constexpr (isDouble)
+		{
+			if (mantissa <= (1ull << 53) && exponent >= -22 && exponent <= 22)
+			{
+				return (F)(exponent < 0 ? (F64)mantissa / POW10_F64[-exponent] : (F64)mantissa * POW10_F64[exponent]);
+			}
+		}
+		else
+		{
+			if (mantissa <= (1ull << 24) && exponent >= -10 && exponent <= 10)
+			{
+				return exponent < 0 ? (F32)mantissa / (F32)POW10_F64[-exponent] : (F32)mantissa * (F32)POW10_F64[exponent];
+			}
+		}
+	}
+
+	//A few ulps off at worst, then walked to the nearest float
+	F64 estimate = (F64)mantissa;
+	I32 remaining = exponent;
+
+	while (remaining > 22) { estimate *= 1e22; remaining -= 22; }
+	while (remaining < -22) { estimate /= 1e22; remaining += 22; }
+	estimate = remaining < 0 ? estimate / POW10_F64[-remaining] : estimate * POW10_F64[remaining];
+
+	U64 bits = ToBits((F)estimate);
+
+	while (true)
+	{
+		if (bits < INFINITY_BITS<F>)
+		{
+			const I32 above = CompareText<C, F>(mantissa, exponent, truncated, digits, digitsEnd, bits);
+			if (above > 0 || (above == 0 && (bits & 1))) { ++bits; continue; }
+		}
+
+		if (bits > 0)
+		{
+			const I32 below = CompareText<C, F>(mantissa, exponent, truncated, digits, digitsEnd, bits - 1);
+			if (below < 0 || (below == 0 && (bits & 1))) { --bits; continue; }
+		}
+
+		return FromBits<F>(bits);
+	}
+}
+
+template<Character C, FloatingPoint F>
+inline I32 NumberText::CompareText(U64 mantissa, I32 exponent, bool truncated, const C* digits, const C* digitsEnd, U64 bits) noexcept
+{
+	const I32 order = CompareHalfway<F>(BigInteger{ { (U32)mantissa, (U32)(mantissa >> 32) }, 2 }, exponent, bits);
+	if (!truncated) { return order; }
+
+	//The text is past its kept digits, so it's above a halfway they reach and below one the next value up reaches
+	if (order >= 0) { return 1; }
+
+	const U64 next = mantissa + 1;
+	if (CompareHalfway<F>(BigInteger{ { (U32)next, (U32)(next >> 32) }, 2 }, exponent, bits) <= 0) { return -1; }
+
+	//The halfway point falls between them, only every digit decides
+	BigInteger all{ { 0 }, 1 };
+	U32 used = 0;
+	U32 chunk = 0;
+	U32 chunkDigits = 0;
+	bool sticky = false;
+
+	for (const C* c = digits; c != digitsEnd; ++c)
+	{
+		if (*c == StringLookup<C>::DECIMAL_CHAR) { continue; }
+
+		const U32 digit = (U32)(*c - (C)'0');
+
+		if (!used && !digit) { continue; }
+		if (used == HALFWAY_DIGITS_MAX) { sticky |= digit != 0; continue; }
+
+		chunk = chunk * 10 + digit;
+		++used;
+
+		if (++chunkDigits == 9)
+		{
+			all.MultiplySmall((U32)POW10[9]);
+			all.AddSmall(chunk);
+			chunk = 0;
+			chunkDigits = 0;
+		}
+	}
+
+	if (chunkDigits)
+	{
+		all.MultiplySmall((U32)POW10[chunkDigits]);
+		all.AddSmall(chunk);
+	}
+
+	//The kept digits were the first 19 of these
+	const I32 exact = CompareHalfway<F>(all, exponent + 19 - (I32)used, bits);
+	return exact == 0 && sticky ? 1 : exact;
+}
+
+template<FloatingPoint F>
+inline I32 NumberText::CompareHalfway(const BigInteger& digits, I32 exponent, U64 bits) noexcept
+{
+	//The point halfway between bits and the next float up, as halfway * 2^twos
+	const DiyFp low = Decode<F>(bits);
+	const DiyFp high = Decode<F>(bits + 1);
+	const I32 e = low.e < high.e ? low.e : high.e;
+	const U64 halfway = (low.f << (low.e - e)) + (high.f << (high.e - e));
+
+	//digits * 5^exponent * 2^exponent against halfway * 2^(e - 1), the negative side's powers move across
+	BigInteger left = digits;
+	BigInteger right{ { (U32)halfway, (U32)(halfway >> 32) }, 2 };
+	I32 leftTwos = 0;
+	I32 rightTwos = e - 1;
+
+	if (exponent >= 0) { left.MultiplyPow5((U32)exponent); leftTwos += exponent; }
+	else { right.MultiplyPow5((U32)-exponent); rightTwos -= exponent; }
+
+	const I32 common = leftTwos < rightTwos ? leftTwos : rightTwos;
+	left.ShiftLeft((U32)(leftTwos - common));
+	right.ShiftLeft((U32)(rightTwos - common));
+
+	return BigInteger::Compare(left, right);
+}
+
+inline bool NumberText::EightDigits(U64 chunk) noexcept
+{
+	//Every byte is 0x30 to 0x39 if its top nibble is 3 and adding 6 doesn't carry out of the bottom one
+	return (((chunk & 0xF0F0F0F0F0F0F0F0ull) | (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) == 0x3333333333333333ull);
+}
+
+inline U32 NumberText::ParseEight(U64 chunk) noexcept
+{
+	//Neighbouring digits, then pairs, then quads are combined in place, the first character is the lowest byte
+	chunk -= 0x3030303030303030ull;
+	chunk = (chunk * 10) + (chunk >> 8);
+	chunk = (((chunk & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) + (((chunk >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32;
+
+	return (U32)chunk;
+}
+
+inline void NumberText::BigInteger::MultiplySmall(U32 multiplier) noexcept
+{
+	U64 carry = 0;
+
+	for (U32 i = 0; i < count; ++i)
+	{
+		const U64 product = (U64)words[i] * multiplier + carry;
+		words[i] = (U32)product;
+		carry = product >> 32;
+	}
+
+	if (carry) { words[count++] = (U32)carry; }
+}
+
+inline void NumberText::BigInteger::AddSmall(U32 value) noexcept
+{
+	U64 carry = value;
+
+	for (U32 i = 0; carry && i < count; ++i)
+	{
+		const U64 sum = (U64)words[i] + carry;
+		words[i] = (U32)sum;
+		carry = sum >> 32;
+	}
+
+	if (carry) { words[count++] = (U32)carry; }
+}
+
+inline void NumberText::BigInteger::MultiplyPow5(U32 power) noexcept
+{
+	while (power >= 13) { MultiplySmall(1220703125); power -= 13; }
+	if (power) { MultiplySmall(POW5[power]); }
+}
+
+inline void NumberText::BigInteger::ShiftLeft(U32 bits) noexcept
+{
+	const U32 wordShift = bits / 32;
+	const U32 bitShift = bits % 32;
+
+	if (bitShift)
+	{
+		U32 carry = 0;
+
+		for (U32 i = 0; i < count; ++i)
+		{
+			const U32 word = words[i];
+			words[i] = (word << bitShift) | carry;
+			carry = word >> (32 - bitShift);
+		}
+
+		if (carry) { words[count++] = carry; }
+	}
+
+	if (wordShift)
+	{
+		for (U32 i = count; i--;) { words[i + wordShift] = words[i]; }
+		for (U32 i = 0; i < wordShift; ++i) { words[i] = 0; }
+
+		count += wordShift;
+	}
+}
+
+inline I32 NumberText::BigInteger::Compare(const BigInteger& a, const BigInteger& b) noexcept
+{
+	U32 countA = a.count;
+	U32 countB = b.count;
+
+	while (countA && !a.words[countA - 1]) { --countA; }
+	while (countB && !b.words[countB - 1]) { --countB; }
+
+	if (countA != countB) { return countA < countB ? -1 : 1; }
+
+	for (U32 i = countA; i--;)
+	{
+		if (a.words[i] != b.words[i]) { return a.words[i] < b.words[i] ? -1 : 1; }
+	}
+
+	return 0;
+}
\ No newline at end of file
@@ -8,7 +8,7 @@ struct Pool
 {
 	static constexpr U64 ResourceSize = sizeof(Type);
 	static constexpr U64 ResourceCount = Count;
-	static constexpr U64 MemorySize = ResourceCount * (ResourceSize + sizeof(U32));
+	static constexpr U64 MemorySize = ResourceCount * (ResourceSize + sizeof(U64));
 
 	void Create();
 	void Destroy();
@@ -29,7 +29,7 @@ template<class Type, U64 Count>
 inline void Pool<Type, Count>::Create()
 {
 	Memory::AllocateSize(&memory, MemorySize);
-	freeHandles = (U64*)(memory + ResourceCount * ResourceSize);
+	freeHandles = (U64*)((U8*)memory + ResourceCount * ResourceSize);
 
 	for (U64 i = 0; i < ResourceCount; ++i) { freeHandles[i] = i; }
 }
@@ -0,0 +1,658 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Vector.hpp"
+
+/*
+* A Vector that keeps its first N values inside itself, array only moves to Memory once size passes N
+*
+* Values are copied bitwise like Vector's, moving a SmallVector that is still inline copies its values
+*/
+template<typename T, U64 N>
+struct SmallVector
+{
+	static_assert(N > 0, "SmallVector needs room for at least one value");
+
+public:
+	/// <summary>
+	/// Creates a new SmallVector instance, size will be zero, capacity will be N, array will be the inline storage
+	/// </summary>
+	SmallVector();
+
+	/// <summary>
+	/// Creates a new SmallVector instance, size will be zero, allocates array if capacity is more than N
+	/// </summary>
+	/// <param name="capacity:">The capacity to reserve</param>
+	SmallVector(U64 capacity);
+
+	/// <summary>
+	/// Creates a new SmallVector instance, allocates array if size is more than N and fills it with value
+	/// </summary>
+	/// <param name="size:">The size the array will be at</param>
+	/// <param name="value:">The value that the array will be filled with</param>
+	SmallVector(U64 size, const T& value);
+
+	/// <summary>
+	/// Creates a new SmallVector instance and copies other's data into it, allocates array if other's size is more than N
+	/// </summary>
+	/// <param name="other:">SmallVector to copy</param>
+	SmallVector(const SmallVector& other);
+
+	/// <summary>
+	/// Creates a new SmallVector instance, takes other's array if it's allocated, copies other's inline values otherwise
+	/// WARNING: other will be destroyed
+	/// </summary>
+	/// <param name="other:">The SmallVector to move</param>
+	SmallVector(SmallVector&& other) noexcept;
+
+	/// <summary>
+	/// Copies other's data into this, allocates array if other's size doesn't fit
+	/// WARNING: any previous data will be lost
+	/// </summary>
+	/// <param name="other:">The SmallVector to copy</param>
+	/// <returns>Reference to this</returns>
+	SmallVector& operator=(const SmallVector& other);
+
+	/// <summary>
+	/// Moves other's data into this, takes other's array if it's allocated, copies other's inline values otherwise
+	/// WARNING: any previous data will be lost
+	/// WARNING: other will be destroyed
+	/// </summary>
+	/// <param name="other:">The SmallVector to move</param>
+	/// <returns>Reference to this</returns>
+	SmallVector& operator=(SmallVector&& other) noexcept;
+
+
+
+	~SmallVector();
+
+	/// <summary>
+	/// Frees array if it was allocated, size will be zero, capacity will be N, array will be the inline storage
+	/// </summary>
+	void Destroy();
+
+
+
+	/// <summary>
+	/// Increases size by one and puts value onto the back of array, moves array to Memory if it's too small
+	/// </summary>
+	/// <param name="value:">The value to put into array</param>
+	void Push(const T& value);
+
+	/// <summary>
+	/// Increases size by one and moves value onto the back of array, moves array to Memory if it's too small
+	/// </summary>
+	/// <param name="value:">The value to move into array</param>
+	void Push(T&& value) noexcept;
+
+	/// <summary>
+	/// Decreases the size by one
+	/// </summary>
+	void Pop();
+
+	/// <summary>
+	/// Decreases the size by one and moves what was in the back of array to value
+	/// </summary>
+	/// <param name="value:">The value to move to</param>
+	void Pop(T& value);
+
+	/// <summary>
+	/// Inserts value into index, moves values at and past index over, moves array to Memory if it's too small
+	/// </summary>
+	/// <param name="index:">The index to put value</param>
+	/// <param name="value:">The value to copy</param>
+	void Insert(U64 index, const T& value);
+
+	/// <summary>
+	/// Inserts value into index, moves values at and past index over, moves array to Memory if it's too small
+	/// </summary>
+	/// <param name="index:">The index to put value</param>
+	/// <param name="value:">The value to move</param>
+	void Insert(U64 index, T&& value) noexcept;
+
+	/// <summary>
+	/// Removes the value at index, moves values past index back
+	/// </summary>
+	/// <param name="index:">The index to remove</param>
+	void Remove(U64 index);
+
+	/// <summary>
+	/// Removes the value at index and moves it into value, moves values past index back
+	/// </summary>
+	/// <param name="index:">The index to remove</param>
+	/// <param name="value:">The value to move to</param>
+	void Remove(U64 index, T& value);
+
+	/// <summary>
+	/// Removes the value at index, moves the back of array into index
+	/// WARNING: this changes the order of values
+	/// </summary>
+	/// <param name="index:">The index to remove</param>
+	void RemoveSwap(U64 index);
+
+	/// <summary>
+	/// Removes the value at index and moves it into value, moves the back of array into index
+	/// WARNING: this changes the order of values
+	/// </summary>
+	/// <param name="index:">The index to remove</param>
+	/// <param name="value:">The value to move to</param>
+	void RemoveSwap(U64 index, T& value);
+
+	/// <summary>
+	/// Removes values from index0 up to index1, moves values past index1 back
+	/// </summary>
+	/// <param name="index0:">The first index to remove</param>
+	/// <param name="index1:">The index after the last one to remove</param>
+	void Erase(U64 index0, U64 index1);
+
+
+
+	/// <summary>
+	/// Searches array, finds all values that satisfy predicate, removes them from array
+	/// </summary>
+	/// <param name="predicate:">A function to evaluate values: bool pred(const T& value)</param>
+	/// <returns>The count of values that satisfy predicate</returns>
+	template<typename Predicate> U64 RemoveAll(Predicate predicate);
+
+	/// <summary>
+	/// Finds the first value that satisfies the predicate, return true if one exists
+	/// </summary>
+	/// <param name="predicate:">A function to evaluate values: bool pred(const T& value)</param>
+	/// <param name="value:">A reference to return the found value</param>
+	/// <returns>true if a value exists, false otherwise</returns>
+	template<typename Predicate> bool Find(Predicate predicate, T& value);
+
+	/// <summary>
+	/// Sorts array with Vector's introsort
+	/// WARNING: not stable, equal values may change order
+	/// </summary>
+	/// <param name="predicate:">Returns true if a goes before b: bool pred(const T& a, const T& b)</param>
+	template<typename Predicate> void Sort(Predicate predicate);
+
+	/// <summary>
+	/// Sorts array in ascending order with Vector's introsort using operator&lt;
+	/// </summary>
+	void Sort();
+
+	/// <summary>
+	/// Sorts array with Vector's merge sort, equal values keep their order, allocates a buffer the size of array
+	/// </summary>
+	/// <param name="predicate:">Returns true if a goes before b: bool pred(const T& a, const T& b)</param>
+	template<typename Predicate> void StableSort(Predicate predicate);
+
+
+
+	/// <summary>
+	/// Makes sure array can hold capacity values, moves array to Memory the first time capacity is more than N
+	/// </summary>
+	/// <param name="capacity:">The capacity to reserve</param>
+	void Reserve(U64 capacity);
+
+	/// <summary>
+	/// Sets size, reserves if size is more than capacity
+	/// WARNING: new values are left as they were in memory
+	/// </summary>
+	/// <param name="size:">The new size</param>
+	void Resize(U64 size);
+
+	/// <summary>
+	/// Sets size, reserves if size is more than capacity and fills every value with value
+	/// </summary>
+	/// <param name="size:">The new size</param>
+	/// <param name="value:">The value to fill array with</param>
+	void Resize(U64 size, const T& value);
+
+	/// <summary>
+	/// Sets size to zero, array stays where it is
+	/// </summary>
+	void Clear() { size = 0; }
+
+
+
+	/// <summary>
+	/// Searches array for value
+	/// </summary>
+	/// <param name="value:">The value to search for</param>
+	/// <returns>true if value is contained within array, false otherwise</returns>
+	bool Contains(const T& value) const;
+
+	/// <summary>
+	/// Counts the reoccurrences of value in array
+	/// </summary>
+	/// <param name="value:">The value to search for</param>
+	/// <returns>The number of reoccurrences of value</returns>
+	U64 Count(const T& value) const;
+
+	/// <summary>
+	/// Finds the first index of value
+	/// </summary>
+	/// <param name="value:">The value to search for</param>
+	/// <returns>The index of value, if it doesn't find value, U64_MAX</returns>
+	U64 Find(const T& value) const;
+
+	/// <summary>
+	/// Puts value onto the back of array if array doesn't contain it
+	/// </summary>
+	/// <param name="value:">The value to copy</param>
+	/// <returns>true if value was added, false otherwise</returns>
+	bool PushUnique(const T& value);
+
+
+
+	/// <summary></summary>
+	/// <returns>size</returns>
+	U64 Size() const { return size; }
+
+	/// <summary></summary>
+	/// <returns>capacity</returns>
+	U64 Capacity() const { return capacity; }
+
+	/// <summary></summary>
+	/// <returns>true while array is the inline storage, false once it's been moved to Memory</returns>
+	bool Inline() const { return array == (const T*)storage; }
+
+	/// <summary></summary>
+	/// <returns>array (const)</returns>
+	const T* Data() const { return array; }
+
+	/// <summary></summary>
+	/// <returns>array</returns>
+	T* Data() { return array; }
+
+
+
+	/// <summary></summary>
+	/// <param name="i:">Index</param>
+	/// <returns>The value at index (const)</returns>
+	const T& operator[](U64 i) const { return array[i]; }
+
+	/// <summary></summary>
+	/// <param name="i:">Index</param>
+	/// <returns>The value at index</returns>
+	T& operator[](U64 i) { return array[i]; }
+
+	/// <summary>
+	/// Gets the value at the front of array (index 0)
+	/// </summary>
+	/// <returns>The value at the front of array</returns>
+	T& Front() { return *array; }
+
+	/// <summary>
+	/// Gets the value at the front of array (index 0)
+	/// </summary>
+	/// <returns>The value at the front of array (const)</returns>
+	const T& Front() const { return *array; }
+
+	/// <summary>
+	/// Gets the value at the back of array (index size - 1)
+	/// </summary>
+	/// <returns>The value at the back of array</returns>
+	T& Back() { return array[size - 1]; }
+
+	/// <summary>
+	/// Gets the value at the back of array (index size - 1)
+	/// </summary>
+	/// <returns>The value at the back of array (const)</returns>
+	const T& Back() const { return array[size - 1]; }
+
+
+
+	/// <summary>
+	/// Compares the values stored in both vectors
+	/// </summary>
+	/// <param name="other: ">The other vector to compare against</param>
+	/// <returns>True if the two vectors have the same values</returns>
+	bool operator==(const SmallVector& other) const;
+
+	/// <summary>
+	/// Compares the values stored in both vectors
+	/// </summary>
+	/// <param name="other: ">The other vector to compare against</param>
+	/// <returns>True if the two vectors have different values</returns>
+	bool operator!=(const SmallVector& other) const;
+
+
+
+	/// <summary></summary>
+	/// <returns>The beginning of array as an iterator</returns>
+	T* begin() { return array; }
+
+	/// <summary></summary>
+	/// <returns>The end of array as an iterator</returns>
+	T* end() { return array + size; }
+
+	/// <summary></summary>
+	/// <returns>The beginning of array as an iterator (const)</returns>
+	const T* begin() const { return array; }
+
+	/// <summary></summary>
+	/// <returns>The end of array as an iterator (const)</returns>
+	const T* end() const { return array + size; }
+
+private:
+	/// <summary>
+	/// Takes other's values, leaves other empty and inline
+	/// </summary>
+	void Take(SmallVector& other);
+
+	/// <summary>
+	/// The count of values inside array
+	/// </summary>
+	U64 size{ 0 };
+
+	/// <summary>
+	/// The actual size of array, N until it's moved to Memory
+	/// </summary>
+	U64 capacity{ N };
+
+	/// <summary>
+	/// Points at storage, or at memory from Memory once size has passed N
+	/// </summary>
+	T* array{ (T*)storage };
+
+	/// <summary>
+	/// Room for the first N values
+	/// </summary>
+	alignas(T) U8 storage[sizeof(T) * N];
+};
+
+template<typename T, U64 N> inline SmallVector<T, N>::SmallVector() {}
+
+template<typename T, U64 N> inline SmallVector<T, N>::SmallVector(U64 capacity) { Reserve(capacity); }
+
+template<typename T, U64 N> inline SmallVector<T, N>::SmallVector(U64 size, const T& value) { Resize(size, value); }
+
+template<typename T, U64 N> inline SmallVector<T, N>::SmallVector(const SmallVector& other)
+{
+	Reserve(other.size);
+	Memory::Copy(array, other.array, sizeof(T) * other.size);
+	size = other.size;
+}
+
+template<typename T, U64 N> inline SmallVector<T, N>::SmallVector(SmallVector&& other) noexcept { Take(other); }
+
+template<typename T, U64 N> inline SmallVector<T, N>& SmallVector<T, N>::operator=(const SmallVector& other)
+{
+	if (this == &other) { return *this; }
+
+	size = 0;
+	Reserve(other.size);
+	Memory::Copy(array, other.array, sizeof(T) * other.size);
+	size = other.size;
+
+	return *this;
+}
+
+template<typename T, U64 N> inline SmallVector<T, N>& SmallVector<T, N>::operator=(SmallVector&& other) noexcept
+{
+	if (this == &other) { return *this; }
+
+	Destroy();
+	Take(other);
+
+	return *this;
+}
+
+template<typename T, U64 N> inline SmallVector<T, N>::~SmallVector() { Destroy(); }
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Destroy()
+{
+	if (!Inline()) { Memory::Free(&array); }
+
+	size = 0;
+	capacity = N;
+	array = (T*)storage;
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Push(const T& value)
+{
+	if (size == capacity) { Reserve(capacity + 1); }
+
+	array[size++] = value;
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Push(T&& value) noexcept
+{
+	if (size == capacity) { Reserve(capacity + 1); }
+
+	array[size++] = Move(value);
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Pop()
+{
+	if (size) { --size; }
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Pop(T& value)
+{
+	if (size) { value = Move(array[--size]); }
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Insert(U64 index, const T& value)
+{
+	if (size == capacity) { Reserve(capacity + 1); }
+
+	Memory::Copy(array + index + 1, array + index, (size - index) * sizeof(T));
+	array[index] = value;
+	++size;
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Insert(U64 index, T&& value) noexcept
+{
+	if (size == capacity) { Reserve(capacity + 1); }
+
+	Memory::Copy(array + index + 1, array + index, (size - index) * sizeof(T));
+	array[index] = Move(value);
+	++size;
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Remove(U64 index)
+{
+	--size;
+	Memory::Copy(array + index, array + index + 1, (size - index) * sizeof(T));
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Remove(U64 index, T& value)
+{
+	value = Move(array[index]);
+	--size;
+	Memory::Copy(array + index, array + index + 1, (size - index) * sizeof(T));
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::RemoveSwap(U64 index)
+{
+	--size;
+	if (index != size) { array[index] = Move(array[size]); }
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::RemoveSwap(U64 index, T& value)
+{
+	value = Move(array[index]);
+	--size;
+	if (index != size) { array[index] = Move(array[size]); }
+}
+
+template<typename T, U64 N> inline void SmallVector<T, N>::Erase(U64 index0, U64 index1)
+{
+	Memory::Copy(array + index0, array + index1, (size - index1) * sizeof(T));
+	size -= index1 - index0;
+}
+
+template<typename T, U64 N>
+template<typename Predicate>
+inline U64 SmallVector<T, N>::RemoveAll(Predicate predicate)
+{
+	T* out = array;
+
+	for (T* t = array, *end = array + size; t != end; ++t)
+	{
+		if (predicate(*t)) { continue; }
+		if (out != t) { *out = Move(*t); }
+		++out;
+	}
+
+	U64 removed = size - (out - array);
+	size = out - array;
+
+	return removed;
+}
+
+template<typename T, U64 N>
+template<typename Predicate>
+inline bool SmallVector<T, N>::Find(Predicate predicate, T& value)
+{
+	for (T* t = array, *end = array + size; t != end; ++t)
+	{
+		if (predicate(*t)) { value = *t; return true; }
+	}
+
+	return false;
+}
+
+template<typename T, U64 N>
+template<typename Predicate>
+inline void SmallVector<T, N>::Sort(Predicate predicate)
+{
+	U64 depth = 0;
+	for (U64 n = size; n > 1; n >>= 1) { depth += 2; }
+
+	Vector<T>::IntroSort(array, array + size, depth, predicate);
+}
+
+template<typename T, U64 N>
+inline void SmallVector<T, N>::Sort()
+{
+	Sort([](const T& a, const T& b) { return a < b; });
+}
+
+template<typename T, U64 N>
+template<typename Predicate>
+inline void SmallVector<T, N>::StableSort(Predicate predicate)
+{
+	//Short enough for a single insertion sort pass, which is already stable
+	if (size <= SORT_INSERTION_MAX) { Vector<T>::InsertionSort(array, array + size, predicate); return; }
+
+	T* buffer;
+	Memory::AllocateArray(&buffer, size);
+
+	Vector<T>::MergeSort(array, buffer, size, predicate);
+
+	Memory::Free(&buffer);
+}
+
+template<typename T, U64 N>
+inline void SmallVector<T, N>::Reserve(U64 capacity)
+{
+	if (capacity <= this->capacity) { return; }
+
+	if (Inline())
+	{
+		T* heap;
+		Memory::AllocateArray(&heap, capacity, this->capacity);
+		Memory::Copy(heap, array, sizeof(T) * size);
+		array = heap;
+	}
+	else { Memory::Reallocate(&array, capacity, this->capacity); }
+}
+
+template<typename T, U64 N>
+inline void SmallVector<T, N>::Resize(U64 size)
+{
+	if (size > capacity) { Reserve(size); }
+	this->size = size;
+}
+
+template<typename T, U64 N>
+inline void SmallVector<T, N>::Resize(U64 size, const T& value)
+{
+	if (size > capacity) { Reserve(size); }
+	this->size = size;
+
+	for (U64 i = 0; i < size; ++i) { array[i] = value; }
+}
+
+template<typename T, U64 N>
+inline bool SmallVector<T, N>::Contains(const T& value) const
+{
+	for (const T* t = array, *end = array + size; t != end; ++t)
+	{
+		if (*t == value) { return true; }
+	}
+
+	return false;
+}
+
+template<typename T, U64 N>
+inline U64 SmallVector<T, N>::Count(const T& value) const
+{
+	U64 count = 0;
+	for (const T* t = array, *end = array + size; t != end; ++t)
+	{
+		if (*t == value) { ++count; }
+	}
+
+	return count;
+}
+
+template<typename T, U64 N>
+inline U64 SmallVector<T, N>::Find(const T& value) const
+{
+	for (U64 index = 0; index < size; ++index)
+	{
+		if (array[index] == value) { return index; }
+	}
+
+	return U64_MAX;
+}
+
+template<typename T, U64 N>
+inline bool SmallVector<T, N>::PushUnique(const T& value)
+{
+	if (Contains(value)) { return false; }
+
+	Push(value);
+	return true;
+}
+
+template<typename T, U64 N>
+inline bool SmallVector<T, N>::operator==(const SmallVector& other) const
+{
+	if (size != other.size) { return false; }
+
+	for (U64 i = 0; i < size; ++i)
+	{
+		if (!(array[i] == other.array[i])) { return false; }
+	}
+
+	return true;
+}
+
+template<typename T, U64 N>
+inline bool SmallVector<T, N>::operator!=(const SmallVector& other) const
+{
+	return !(*this == other);
+}
+
+template<typename T, U64 N>
+inline void SmallVector<T, N>::Take(SmallVector& other)
+{
+	size = other.size;
+
+	if (other.Inline())
+	{
+		capacity = N;
+		array = (T*)storage;
+		Memory::Copy(array, other.array, sizeof(T) * size);
+	}
+	else
+	{
+		capacity = other.capacity;
+		array = other.array;
+	}
+
+	other.size = 0;
+	other.capacity = N;
+	other.array = (T*)other.storage;
+}
\ No newline at end of file
@@ -3,6 +3,9 @@
 #include "ContainerDefines.hpp"
 
 #include "Vector.hpp"
+#include "StringView.hpp"
+#include "NumberText.hpp"
+#include "FormatString.hpp"
 #include "Memory\Memory.hpp"
 #include "Math\Hash.hpp"
 #include "Math\Random.hpp"
@@ -85,9 +88,10 @@ struct StringBase
 	StringBase() noexcept;
 	StringBase(const StringBase& other) noexcept;
 	StringBase(StringBase&& other) noexcept;
+	StringBase(const StringViewBase<C>& view) noexcept;
 	template<typename First, typename... Args> StringBase(const First& first, const Args& ... args) noexcept;
-	template<typename... Args> StringBase& Format(const C* format, const Args& ... args) noexcept; //TODO: Take in any string literal type
-	template<typename... Args> StringBase& Format(U64 start, const C* format, const Args& ... args) noexcept; //TODO: Take in any string literal type
+	template<typename... Args> StringBase& Format(FormatStringBase<C, TypeIdentity<Args>...> format, const Args& ... args) noexcept;
+	template<typename... Args> StringBase& Format(U64 start, FormatStringBase<C, TypeIdentity<Args>...> format, const Args& ... args) noexcept;
 
 	StringBase& operator=(NullPointer) noexcept;
 	StringBase& operator=(const StringBase& other) noexcept;
@@ -125,6 +129,8 @@ struct StringBase
 	bool operator!=(C* other) const noexcept;
 	bool operator!=(const StringBase& other) const noexcept;
 	template<U64 Count> bool operator!=(const C(&other)[Count]) const noexcept;
+	bool operator==(const StringViewBase<C>& other) const noexcept;
+	bool operator!=(const StringViewBase<C>& other) const noexcept;
 
 	bool operator<(const StringBase& other) const noexcept;
 	bool operator>(const StringBase& other) const noexcept;
@@ -141,12 +147,16 @@ struct StringBase
 	bool EndsWith(C* other) const noexcept;
 	bool EndsWith(const StringBase& other) const noexcept;
 	template<U64 Count> bool EndsWith(const C(&other)[Count]) const noexcept;
+	bool Compare(const StringViewBase<C>& other) const noexcept;
+	bool StartsWith(const StringViewBase<C>& other) const noexcept;
+	bool EndsWith(const StringViewBase<C>& other) const noexcept;
 
 	bool Blank() const noexcept;
 	I64 IndexOf(C* find, U64 start = 0) const noexcept;
 	I64 IndexOf(const C& find, U64 start = 0) const noexcept;
 	I64 IndexOf(const StringBase& find, U64 start = 0) const noexcept;
 	template<U64 Count> I64 IndexOf(const C(&find)[Count], U64 start = 0) const noexcept;
+	I64 IndexOf(const StringViewBase<C>& find, U64 start = 0) const noexcept;
 	I64 LastIndexOf(C* find, U64 start = 0) const noexcept;
 	I64 LastIndexOf(const C& find, U64 start = 0) const noexcept;
 	I64 LastIndexOf(const StringBase& find, U64 start = 0) const noexcept;
@@ -168,6 +178,8 @@ struct StringBase
 	template<typename Arg> StringBase Prepended(const Arg& prepend) const noexcept;
 	template<typename PreArg, typename PostArg> StringBase Surrounded(const PreArg& prepend, const PostArg& append) const noexcept;
 	Vector<StringBase> Split(C delimiter, bool trimEntries) const noexcept;
+	typename StringViewBase<C>::SplitRange SplitView(C delimiter, bool trimEntries = false) const noexcept;
+	StringViewBase<C> View(U64 start = 0, U64 length = U64_MAX) const noexcept;
 
 	StringBase& ToUpper() noexcept;
 	StringBase& ToLower() noexcept;
@@ -180,6 +192,7 @@ struct StringBase
 	const C* Data() const noexcept;
 	operator C* () noexcept;
 	operator const C* () const noexcept;
+	operator StringViewBase<C>() const noexcept;
 
 	C Front() const noexcept;
 	C Back() const noexcept;
@@ -199,7 +212,7 @@ private:
 	template<Signed Arg, bool Hex, bool Insert, U64 Remove = 0> U64 ToString(C* str, const Arg& value) noexcept;
 	template<Unsigned Arg, bool Hex, bool Insert, U64 Remove = 0> U64 ToString(C* str, const Arg& value) noexcept;
 	template<Boolean Arg, bool Hex, bool Insert, U64 Remove = 0> U64 ToString(C* str, const Arg& value) noexcept;
-	template<FloatingPoint Arg, bool Hex, bool Insert, U64 Remove = 0> U64 ToString(C* str, const Arg& value, U64 decimalCount = 5) noexcept;
+	template<FloatingPoint Arg, bool Hex, bool Insert, U64 Remove = 0> U64 ToString(C* str, const Arg& value, U64 decimalCount = U64_MAX) noexcept;
 	template<NonStringPointer Arg, bool Hex, bool Insert, U64 Remove = 0> U64 ToString(C* str, const Arg& value) noexcept;
 	template<Character Arg, bool Hex, bool Insert, U64 Remove = 0> U64 ToString(C* str, const Arg& value) noexcept;
 	template<StringLiteral Arg, bool Hex, bool Insert, U64 Remove = 0, U64 Size = 0> U64 ToString(C* str, const Arg& value) noexcept;
@@ -208,7 +221,8 @@ private:
 
 	template<typename Arg, bool Hex> static constexpr U64 RequiredCapacity() noexcept;
 
-	template<typename Arg> void FindFormat(U64& start, const Arg& value) noexcept;
+	template<typename Arg> void AppendField(const C* format, U64& formatIndex, const FormatField& field, const Arg& value) noexcept;
+	StringBase& ReplaceMatches(const StringViewBase<C>& find, const StringViewBase<C>& replace, U64 count, U64 start) noexcept;
 
 	static bool Compare(const C* a, const C* b, I64 length) noexcept;
 	static bool WhiteSpace(C c) noexcept;
@@ -219,6 +233,8 @@ private:
 	U64 size{ 0 };
 	U64 capacity{ 0 };
 	C* string{ nullptr };
+
+	template<Character, typename...> friend struct FormatStringBase;
 };
 
 template<Character C>
@@ -258,6 +274,14 @@ inline StringBase<C>::StringBase(StringBase&& other) noexcept : needHash{ other.
 	other.string = nullptr;
 }
 
+template<Character C>
+inline StringBase<C>::StringBase(const StringViewBase<C>& view) noexcept : size{ view.Size() }
+{
+	Memory::AllocateArray(&string, size + 1, capacity);
+	Memory::Copy(string, view.Data(), size * sizeof(C));
+	string[size] = StringLookup<C>::NULL_CHAR;
+}
+
 template<Character C>
 template<typename First, typename... Args>
 inline StringBase<C>::StringBase(const First& first, const Args& ... args) noexcept
@@ -269,31 +293,30 @@ inline StringBase<C>::StringBase(const First& first, const Args& ... args) noexc
 
 template<Character C>
 template<typename... Args>
-inline StringBase<C>& StringBase<C>::Format(const C* format, const Args& ... args) noexcept
+inline StringBase<C>& StringBase<C>::Format(FormatStringBase<C, TypeIdentity<Args>...> format, const Args& ... args) noexcept
 {
-	U64 length = Length(format) + 1;
-
-	if (capacity < length) { Memory::Reallocate(&string, length, capacity); }
-	size = length - 1;
-
-	Memory::Copy(string, format, length * sizeof(C));
-	U64 start = 0;
-	(FindFormat(start, args), ...);
-
-	return *this;
+	return Format(0, format, args...);
 }
 
 template<Character C>
 template<typename... Args>
-inline StringBase<C>& StringBase<C>::Format(U64 start, const C* format, const Args& ... args) noexcept
+inline StringBase<C>& StringBase<C>::Format(U64 start, FormatStringBase<C, TypeIdentity<Args>...> format, const Args& ... args) noexcept
 {
-	U64 length = Length(format) + 1;
+	//The placeholders were found while compiling, so this is one reserve then one pass of copies
+	const U64 required = start + format.Capacity(args...) + 1;
+	if (!string || capacity < required) { Memory::Reallocate(&string, required, capacity); }
+
+	size = start;
+	U64 formatIndex = 0;
+	const FormatField* field = format.fields;
 
-	if (capacity < start + length) { Memory::Reallocate(&string, start + length, capacity); }
-	size = start + length - 1;
+	(AppendField(format.text, formatIndex, *field++, args), ...);
 
-	Memory::Copy(string + start, format, length * sizeof(C));
-	(FindFormat(start, args), ...);
+	Memory::Copy(string + size, format.text + formatIndex, (format.length - formatIndex) * sizeof(C));
+	size += format.length - formatIndex;
+
+	string[size] = StringLookup<C>::NULL_CHAR;
+	needHash = true;
 
 	return *this;
 }
@@ -488,6 +511,18 @@ inline bool StringBase<C>::operator!=(const C(&other)[Count]) const noexcept
 }
 
 //TODO: Better comparison than ascii
+template<Character C>
+inline bool StringBase<C>::operator==(const StringViewBase<C>& other) const noexcept
+{
+	return View().Compare(other);
+}
+
+template<Character C>
+inline bool StringBase<C>::operator!=(const StringViewBase<C>& other) const noexcept
+{
+	return !View().Compare(other);
+}
+
 template<Character C>
 inline bool StringBase<C>::operator<(const StringBase<C>& other) const noexcept
 {
@@ -608,6 +643,24 @@ inline bool StringBase<C>::EndsWith(const C(&other)[Count]) const noexcept
 	return Compare(string + (size - Count - 1), other, Count - 1);
 }
 
+template<Character C>
+inline bool StringBase<C>::Compare(const StringViewBase<C>& other) const noexcept
+{
+	return View().Compare(other);
+}
+
+template<Character C>
+inline bool StringBase<C>::StartsWith(const StringViewBase<C>& other) const noexcept
+{
+	return View().StartsWith(other);
+}
+
+template<Character C>
+inline bool StringBase<C>::EndsWith(const StringViewBase<C>& other) const noexcept
+{
+	return View().EndsWith(other);
+}
+
 template<Character C>
 inline U64 StringBase<C>::Size() const noexcept { return size; }
 
@@ -647,6 +700,9 @@ inline StringBase<C>::operator C* () noexcept { return string; }
 template<Character C>
 inline StringBase<C>::operator const C* () const noexcept { return string; }
 
+template<Character C>
+inline StringBase<C>::operator StringViewBase<C>() const noexcept { return { string, size }; }
+
 template<Character C>
 inline C StringBase<C>::Front() const noexcept { return *string; }
 
@@ -671,98 +727,57 @@ inline bool StringBase<C>::Blank() const noexcept
 template<Character C>
 inline I64 StringBase<C>::IndexOf(C* find, U64 start) const noexcept
 {
-	U64 findSize = Length(find);
-	C* it = string + start;
-
-	while (*it != StringLookup<C>::NULL_CHAR && Compare(it, find, findSize)) { ++it; }
-
-	if (*it == StringLookup<C>::NULL_CHAR) { return -1; }
-	return (I64)(it - string);
+	return View().IndexOf(StringViewBase<C>{ find }, start);
 }
 
 template<Character C>
 inline I64 StringBase<C>::IndexOf(const C& find, U64 start) const noexcept
 {
-	C* it = string + start;
-	C c;
-
-	while ((c = *it) != StringLookup<C>::NULL_CHAR && c != find) { ++it; }
-
-	if (c == StringLookup<C>::NULL_CHAR) { return -1; }
-	return (I64)(it - string);
+	return View().IndexOf(find, start);
 }
 
 template<Character C>
 inline I64 StringBase<C>::IndexOf(const StringBase& find, U64 start) const noexcept
 {
-	C* it = string + start;
-
-	while (*it != StringLookup<C>::NULL_CHAR && Compare(it, find.string, find.size)) { ++it; }
-
-	if (*it == StringLookup<C>::NULL_CHAR) { return -1; }
-	return (I64)(it - string);
+	return View().IndexOf(find.View(), start);
 }
 
 template<Character C>
 template<U64 Count> 
 inline I64 StringBase<C>::IndexOf(const C(&find)[Count], U64 start) const noexcept
 {
-	C* it = string + start;
-
-	while (*it != StringLookup<C>::NULL_CHAR && Compare(it, find, Count)) { ++it; }
+	return View().IndexOf(StringViewBase<C>{ find, Count - 1 }, start);
+}
 
-	if (*it == StringLookup<C>::NULL_CHAR) { return -1; }
-	return (I64)(it - string);
+template<Character C>
+inline I64 StringBase<C>::IndexOf(const StringViewBase<C>& find, U64 start) const noexcept
+{
+	return View().IndexOf(find, start);
 }
 
 template<Character C>
 inline I64 StringBase<C>::LastIndexOf(C* find, U64 start) const noexcept
 {
-	U64 findSize = Length(find);
-	C* it = string + size - start - findSize - 1;
-
-	U64 len = size;
-	while (len && Compare(it, find, findSize)) { --it; --len; }
-
-	if (len) { return (I64)(it - string); }
-	return -1;
+	return View(0, start < size ? size - start : 0).LastIndexOf(StringViewBase<C>{ find });
 }
 
 template<Character C>
 inline I64 StringBase<C>::LastIndexOf(const C& find, U64 start) const noexcept
 {
-	C* it = string + size - start - 1;
-
-	U64 len = size;
-	while (len && *it != find) { --it; --len; }
-
-	if (len) { return (I64)(it - string); }
-	return -1;
+	return View(0, start < size ? size - start : 0).LastIndexOf(find);
 }
 
 template<Character C>
 inline I64 StringBase<C>::LastIndexOf(const StringBase& find, U64 start) const noexcept
 {
-	C* it = string + size - start - find.size - 1;
-
-	U64 len = size;
-	while (len && Compare(it, find.string, find.size)) { --it; --len; }
-
-	if (len) { return (I64)(it - string); }
-	return -1;
+	return View(0, start < size ? size - start : 0).LastIndexOf(find.View());
 }
 
 template<Character C>
 template<U64 Count> 
 inline I64 StringBase<C>::LastIndexOf(const C(&find)[Count], U64 start) const noexcept
 {
-	C* it = string + size - start - Count - 1;
-
-	U64 len = size;
-	while (len && Compare(it, find, Count)) { --it; --len; }
-
-	if (len) { return (I64)(it - string); }
-	return -1;
+	return View(0, start < size ? size - start : 0).LastIndexOf(StringViewBase<C>{ find, Count - 1 });
 }
 
 template<Character C>
@@ -829,59 +844,99 @@ template<Character C>
 template<typename Arg>
 inline StringBase<C>& StringBase<C>::ReplaceAll(const C* find, const Arg& replace, U64 start) noexcept
 {
-	U64 findSize = Length(find);
-	C* it = string + start;
-	C c = *it;
+	return ReplaceN(find, replace, U64_MAX, start);
+}
 
-	while (c != StringLookup<C>::NULL_CHAR)
+template<Character C>
+template<typename Arg>
+inline StringBase<C>& StringBase<C>::ReplaceN(const C* find, const Arg& replace, U64 count, U64 start) noexcept
+{
+	//Text replacements are used as they are, anything else is formatted once
+	if constexpr (IsSame<Arg, StringViewBase<C>>) { return ReplaceMatches(find, replace, count, start); }
+	else if constexpr (IsSame<Arg, StringBase<C>>) { return ReplaceMatches(find, replace.View(), count, start); }
+	else if constexpr (IsStringLiteral<Arg> && IsSame<BaseType<Arg>, C>) { return ReplaceMatches(find, StringViewBase<C>{ replace }, count, start); }
+	else
 	{
-		while ((c = *it) != StringLookup<C>::NULL_CHAR && Compare(it, find, findSize)) { ++it; }
-
-		if (c != StringLookup<C>::NULL_CHAR) { ToString<Arg, false, true>(it, replace); }
+		StringBase<C> text(replace);
+		return ReplaceMatches(find, text.View(), count, start);
 	}
-
-	string[size] = StringLookup<C>::NULL_CHAR;
-	needHash = true;
-
-	return *this;
 }
 
 template<Character C>
 template<typename Arg>
-inline StringBase<C>& StringBase<C>::ReplaceN(const C* find, const Arg& replace, U64 count, U64 start) noexcept
+inline StringBase<C>& StringBase<C>::Replace(const C* find, const Arg& replace, U64 start) noexcept
+{
+	return ReplaceN(find, replace, 1, start);
+}
+
+template<Character C>
+inline StringBase<C>& StringBase<C>::ReplaceMatches(const StringViewBase<C>& find, const StringViewBase<C>& replace, U64 count, U64 start) noexcept
 {
-	U64 findSize = Length(find);
-	C* it = string + start;
-	C c = *it;
+	const U64 findSize = find.Size();
+	const U64 replaceSize = replace.Size();
+
+	if (!findSize || !count || start >= size) { return *this; }
 
-	while (c != StringLookup<C>::NULL_CHAR && count)
+	const StringViewBase<C> view{ string, size };
+	U64 read = start;
+	I64 match;
+
+	if (replaceSize <= findSize)
 	{
-		while ((c = *it) != StringLookup<C>::NULL_CHAR && Compare(it, find, findSize)) { ++it; }
+		//Writing never passes reading, so it's done in place and the search only sees characters not yet moved
+		C* write = string + start;
 
-		if (c != StringLookup<C>::NULL_CHAR)
+		while (count && (match = view.IndexOf(find, read)) != -1)
 		{
+			Memory::Copy(write, string + read, (match - read) * sizeof(C));
+			write += match - read;
+			Memory::Copy(write, replace.Data(), replaceSize * sizeof(C));
+			write += replaceSize;
+
+			read = match + findSize;
 			--count;
-			ToString<Arg, false, true>(it, replace);
 		}
+
+		Memory::Copy(write, string + read, (size - read) * sizeof(C));
+		size = (write - string) + (size - read);
 	}
+	else
+	{
+		//Matches are counted first so every character is copied once into a buffer of the final size
+		U64 matches = 0;
 
-	string[size] = StringLookup<C>::NULL_CHAR;
-	needHash = true;
+		for (match = view.IndexOf(find, read); match != -1 && matches < count; match = view.IndexOf(find, match + findSize)) { ++matches; }
 
-	return *this;
-}
+		if (!matches) { return *this; }
 
-template<Character C>
-template<typename Arg>
-inline StringBase<C>& StringBase<C>::Replace(const C* find, const Arg& replace, U64 start) noexcept
-{
-	U64 findSize = Length(find);
-	C* it = string + start;
-	C c;
+		const U64 newSize = size + matches * (replaceSize - findSize);
+		C* result;
+		U64 newCapacity;
 
-	while ((c = *it) != StringLookup<C>::NULL_CHAR && Compare(it, find, findSize)) { ++it; }
+		Memory::AllocateArray(&result, newSize + 1, newCapacity);
+		Memory::Copy(result, string, start * sizeof(C));
 
-	if (c != StringLookup<C>::NULL_CHAR) { ToString<Arg, false, true>(c, replace); }
+		C* write = result + start;
+
+		while (matches--)
+		{
+			match = view.IndexOf(find, read);
+
+			Memory::Copy(write, string + read, (match - read) * sizeof(C));
+			write += match - read;
+			Memory::Copy(write, replace.Data(), replaceSize * sizeof(C));
+			write += replaceSize;
+
+			read = match + findSize;
+		}
+
+		Memory::Copy(write, string + read, (size - read) * sizeof(C));
+		Memory::Free(&string);
+
+		string = result;
+		size = newSize;
+		capacity = newCapacity;
+	}
 
 	string[size] = StringLookup<C>::NULL_CHAR;
 	needHash = true;
@@ -954,7 +1009,28 @@ inline StringBase<C> StringBase<C>::Surrounded(const PreArg& prepend, const Post
 template<Character C>
 inline Vector<StringBase<C>> StringBase<C>::Split(C delimiter, bool trimEntries) const noexcept
 {
-	//TODO: this
+	typename StringViewBase<C>::SplitRange tokens = View().Split(delimiter, trimEntries);
+	U64 count = tokens.Count();
+	Vector<StringBase<C>> strings(count);
+
+	//Push moves into the slots, they have to look like empty strings first
+	Memory::Zero(strings.Data(), sizeof(StringBase<C>) * count);
+
+	for (const StringViewBase<C>& token : tokens) { strings.Push(token); }
+
+	return Move(strings);
+}
+
+template<Character C>
+inline typename StringViewBase<C>::SplitRange StringBase<C>::SplitView(C delimiter, bool trimEntries) const noexcept
+{
+	return View().Split(delimiter, trimEntries);
+}
+
+template<Character C>
+inline StringViewBase<C> StringBase<C>::View(U64 start, U64 length) const noexcept
+{
+	return StringViewBase<C>{ string, size }.SubView(start, length);
 }
 
 template<Character C>
@@ -1200,82 +1276,28 @@ inline U64 StringBase<C>::ToString(C* str, const Arg& value, U64 decimalCount) n
 	if constexpr (Hex) { return ToString<U64, Hex, Insert, Remove>(str, reinterpret_cast<const U64&>(value)); }
 	else
 	{
-		const U64 typeSize = RequiredCapacity<Arg, Hex>() + decimalCount;
-		const U64 moveSize = typeSize - Remove;
+		//U64_MAX decimals is the shortest text that reads back to value
+		C text[NumberText::FLOAT_TEXT_MAX];
+		const U64 length = decimalCount == U64_MAX ? NumberText::WriteShortest(text, value) : NumberText::WriteFixed(text, value, decimalCount);
+
+		U64 moveSize = length;
+		if constexpr (Remove != U64_MAX) { moveSize -= Remove; }
+
 		const U64 strIndex = str - string;
 		const U64 excessSize = size - strIndex;
 
 		if (!string || capacity < size + moveSize) { Memory::Reallocate(&string, size + moveSize, capacity); str = string + strIndex; }
-		if constexpr (Insert) { Memory::Copy(str + moveSize, str, excessSize * sizeof(C)); }
-
-		C* c = str + typeSize;
-		const C* digits;
-		Arg val;
-		U64 neg;
-
-		if (value < 0)
-		{
-			str[0] = StringLookup<C>::NEGATIVE_CHAR;
-			val = (Arg)-value;
-			neg = 1;
-		}
-		else
-		{
-			val = (Arg)value;
-			neg = 0;
-		}
-
-		if (decimalCount > 0)
-		{
-			U64 dec = (U64)((val - (F64)(U64)val) * 100000.0f);
-
-			while (decimalCount > 2)
-			{
-				U64 newVal = dec / 1000;
-				U64 remainder = dec % 1000;
-				digits = StringLookup<C>::DECIMAL_LOOKUP + (remainder * 3);
-				*--c = digits[2];
-				*--c = digits[1];
-				*--c = digits[0];
-				dec = newVal;
-
-				decimalCount -= 3;
-			}
-
-			digits = StringLookup<C>::DECIMAL_LOOKUP + (dec * 3);
-			if (decimalCount > 0) { *--c = digits[2]; }
-			if (decimalCount > 1) { *--c = digits[1]; }
-			*--c = StringLookup<C>::DECIMAL_CHAR;
-		}
-
-		U64 whole = (U64)val;
-
-		while (whole > 999)
-		{
-			U64 newVal = whole / 1000;
-			U64 remainder = whole % 1000;
-			digits = StringLookup<C>::DECIMAL_LOOKUP + (remainder * 3);
-			*--c = digits[2];
-			*--c = digits[1];
-			*--c = digits[0];
-			whole = newVal;
-		}
 
-		digits = StringLookup<C>::DECIMAL_LOOKUP + (whole * 3);
-		*--c = digits[2];
-		if (whole > 9) { *--c = digits[1]; }
-		if (whole > 99) { *--c = digits[0]; }
-
-		I64 addLength = typeSize + neg - (c - str);
-		size += addLength - Remove;
+		if constexpr (Insert) { Memory::Copy(str + moveSize, str, excessSize * sizeof(C)); }
+		Memory::Copy(str, text, length * sizeof(C));
 
-		if constexpr (Insert) { Memory::Copy(str + neg, c, (addLength + excessSize - Remove) * sizeof(C)); }
-		else { Memory::Copy(str + neg, c, addLength * sizeof(C)); }
+		if constexpr (Remove == U64_MAX) { size = moveSize; }
+		else { size += moveSize; }
 
 		string[size] = StringLookup<C>::NULL_CHAR;
 		needHash = true;
 
-		return strIndex + addLength;
+		return strIndex + length;
 	}
 }
 
@@ -1417,7 +1439,28 @@ template<Character C>
 template<NonStringClass Arg, bool Hex, bool Insert, U64 Remove>
 inline U64 StringBase<C>::ToString(C* str, const Arg& value) noexcept
 {
-	if constexpr (ConvertibleTo<Arg, StringBaseType>)
+	if constexpr (IsSame<Arg, StringViewBase<C>>)
+	{
+		U64 moveSize = value.Size();
+		if constexpr (Remove != U64_MAX) { moveSize -= Remove; }
+
+		const U64 strIndex = str - string;
+		const U64 excessSize = size - strIndex;
+
+		if (!string || capacity < size + moveSize) { Memory::Reallocate(&string, size + moveSize, capacity); str = string + strIndex; }
+
+		if constexpr (Insert) { Memory::Copy(str + moveSize, str, excessSize * sizeof(C)); }
+		Memory::Copy(str, value.Data(), value.Size() * sizeof(C));
+
+		if constexpr (Remove == U64_MAX) { size = moveSize; }
+		else { size += moveSize; }
+
+		string[size] = StringLookup<C>::NULL_CHAR;
+		needHash = true;
+
+		return strIndex + value.Size();
+	}
+	else if constexpr (ConvertibleTo<Arg, StringBaseType>)
 	{
 		return ToString<StringBaseType, Hex, Insert, Remove>(str, value.operator StringBaseType());
 	}
@@ -1431,7 +1474,11 @@ template<Character C>
 template<typename Arg, bool Hex>
 inline constexpr U64 StringBase<C>::RequiredCapacity() noexcept
 {
-	if constexpr (Hex)
+	if constexpr (IsBoolean<Arg>) { return 5; }
+	else if constexpr (IsCharacter<Arg>) { return 1; }
+	else if constexpr (IsNonStringPointer<Arg>) { return Hex ? 16 : 20; }
+	else if constexpr (IsFloatingPoint<Arg> && !Hex) { return NumberText::FLOAT_TEXT_MAX; }
+	else if constexpr (Hex)
 	{
 		if constexpr (IsSame<Arg, U8>) { return 2; }
 		if constexpr (IsSame<Arg, U16>) { return 4; }
@@ -1458,28 +1505,18 @@ inline constexpr U64 StringBase<C>::RequiredCapacity() noexcept
 		if constexpr (IsSame<Arg, I32>) { return 11; }
 		if constexpr (IsSame<Arg, L32>) { return 11; }
 		if constexpr (IsSame<Arg, I64>) { return 20; }
-		if constexpr (IsSame<Arg, F32>) { return 22; }
-		if constexpr (IsSame<Arg, F64>) { return 22; }
 	}
+
+	//Strings and classes are only known at runtime
+	return 0;
 }
 
 template<Character C>
 template<Signed Arg>
 inline Arg StringBase<C>::ToType(U64 start) const noexcept
 {
-	C* it = string + start;
-	C c;
-	Arg value = 0;
-
-	if (*it == StringLookup<C>::NEGATIVE_CHAR)
-	{
-		++it;
-		while (NotWhiteSpace(c = *it++) && c != StringLookup<C>::NULL_CHAR) { value *= 10; value -= c - StringLookup<C>::ZERO_CHAR; }
-	}
-	else
-	{
-		while (NotWhiteSpace(c = *it++) && c != StringLookup<C>::NULL_CHAR) { value *= 10; value += c - StringLookup<C>::ZERO_CHAR; }
-	}
+	Arg value;
+	NumberText::ReadSigned(string + start, string + size, value);
 
 	return value;
 }
@@ -1488,11 +1525,8 @@ template<Character C>
 template<Unsigned Arg>
 inline Arg StringBase<C>::ToType(U64 start) const noexcept
 {
-	C* it = string + start;
-	C c;
-	Arg value = 0;
-
-	while (NotWhiteSpace(c = *it++) && c != StringLookup<C>::NULL_CHAR) { value *= 10; value += c - StringLookup<C>::ZERO_CHAR; }
+	Arg value;
+	NumberText::ReadUnsigned(string + start, string + size, value);
 
 	return value;
 }
@@ -1508,26 +1542,8 @@ template<Character C>
 template<FloatingPoint Arg>
 inline Arg StringBase<C>::ToType(U64 start) const noexcept
 {
-	//TODO: Handle NaN, +-INF
-
-	C* it = string + start;
-	C c;
-	Arg value = 0.0f;
-	F64 mul = 0.1f;
-
-	if (*it == StringLookup<C>::NEGATIVE_CHAR)
-	{
-		++it;
-		while (NotWhiteSpace(c = *it++) && c != StringLookup<C>::NULL_CHAR && c != StringLookup<C>::DECIMAL_CHAR) { value *= 10; value -= c - StringLookup<C>::ZERO_CHAR; }
-		while (NotWhiteSpace(c = *it++) && c != StringLookup<C>::NULL_CHAR) { value -= (c - StringLookup<C>::ZERO_CHAR) * mul; mul *= 0.1f; }
-	}
-	else
-	{
-		if (*it == StringLookup<C>::POSITIVE_CHAR) { ++it; }
-
-		while (NotWhiteSpace(c = *it++) && c != StringLookup<C>::NULL_CHAR && c != StringLookup<C>::DECIMAL_CHAR) { value *= 10; value += c - StringLookup<C>::ZERO_CHAR; }
-		while (NotWhiteSpace(c = *it++) && c != StringLookup<C>::NULL_CHAR) { value += (c - StringLookup<C>::ZERO_CHAR) * mul; mul *= 0.1f; }
-	}
+	Arg value;
+	NumberText::ReadFloat(string + start, string + size, value);
 
 	return value;
 }
@@ -1653,29 +1669,21 @@ inline bool StringBase<C>::NotWhiteSpace(C c) noexcept
 
 template<Character C>
 template<typename Arg>
-inline void StringBase<C>::FindFormat(U64& start, const Arg& value) noexcept
+inline void StringBase<C>::AppendField(const C* format, U64& formatIndex, const FormatField& field, const Arg& value) noexcept
 {
-	C* it = string + start;
-	C c = *it;
+	Memory::Copy(string + size, format + formatIndex, (field.offset - formatIndex) * sizeof(C));
+	size += field.offset - formatIndex;
+	formatIndex = field.offset + field.length;
 
-	//TODO: escape characters ``
-	while ((c = *it++) != StringLookup<C>::NULL_CHAR)
+	if constexpr (IsFloatingPoint<Arg>)
 	{
-		if (c == StringLookup<C>::OPEN_BRACE)
-		{
-			c = *it++;
-			switch (c)
-			{
-			case StringLookup<C>::CLOSE_BRACE: { start = ToString<Arg, false, true, 2>(it - 2, value); return; } break;
-			case StringLookup<C>::FMT_HEX: { if (*it == StringLookup<C>::CLOSE_BRACE) { start = ToString<Arg, true, true, 3>(it - 2, value); return; } } break;
-			case StringLookup<C>::FMT_DEC: {
-				if constexpr (IsFloatingPoint<Arg>)
-				{
-					if (*it == StringLookup<C>::CLOSE_BRACE) { start = ToString<Arg, false, true, 3>(it - 2, value, 5); return; }
-					else if (it[1] == StringLookup<C>::CLOSE_BRACE) { start = ToString<Arg, false, true, 4>(it - 2, value, *it - '0'); return; }
-				}
-			} break;
-			}
-		}
+		if (field.hex) { ToString<Arg, true, false>(string + size, value); }
+		else { ToString<Arg, false, false>(string + size, value, field.decimals); }
+	}
+	else if constexpr (IsInteger<Arg> || IsNonStringPointer<Arg>)
+	{
+		if (field.hex) { ToString<Arg, true, false>(string + size, value); }
+		else { ToString<Arg, false, false>(string + size, value); }
 	}
+	else { ToString<Arg, false, false>(string + size, value); }
 }
\ No newline at end of file
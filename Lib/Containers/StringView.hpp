@@ -0,0 +1,545 @@
+#pragma once
+
+#include "ContainerDefines.hpp"
+
+#include "NumberText.hpp"
+#include "Math\Hash.hpp"
+#include "SIMD.hpp"
+
+#if defined __AVX2__ || defined NH_SSE2
+#	define NH_STRING_SIMD
+#endif
+
+template<Character C> struct StringViewBase;
+
+using StringView = StringViewBase<C8>;
+using StringView8 = StringViewBase<C8>;
+using StringView16 = StringViewBase<C16>;
+using StringView32 = StringViewBase<C32>;
+
+/*
+* Characters owned by something else, a pointer and a size. A view isn't null terminated and is only good while the
+* string it looks at is alive and unchanged, nothing on it allocates
+*
+* Split and Tokenize return ranges that find each token as they're iterated, so walking a file line by line and then
+* field by field never copies anything. Hash matches String's const Hash, a view can look up a String keyed table
+*
+* Searches compare a register of characters at a time with AVX2 or SSE2, substrings are found by matching their first
+* and last character across the register and only comparing the middle where both hit
+*/
+template<Character C>
+struct StringViewBase
+{
+	struct SplitRange;
+
+	/// <summary>
+	/// Walks a SplitRange, yields each token as a view into the source
+	/// </summary>
+	struct SplitIterator
+	{
+	public:
+		const StringViewBase& operator*() const noexcept { return token; }
+		const StringViewBase* operator->() const noexcept { return &token; }
+		SplitIterator& operator++() noexcept { Next(); return *this; }
+
+		bool operator==(const SplitIterator& other) const noexcept { return done == other.done && (done || token.string == other.token.string); }
+		bool operator!=(const SplitIterator& other) const noexcept { return !(*this == other); }
+
+	private:
+		void Next() noexcept;
+
+		const SplitRange* range{ nullptr };
+
+		/// <summary>
+		/// Start of the next token, only good while more is set
+		/// </summary>
+		const C* next{ nullptr };
+		StringViewBase token;
+		bool more{ false };
+		bool done{ true };
+
+		friend struct SplitRange;
+	};
+
+	/// <summary>
+	/// The tokens of a view, from Split or Tokenize
+	/// </summary>
+	struct SplitRange
+	{
+	public:
+		SplitIterator begin() const noexcept;
+		SplitIterator end() const noexcept { return {}; }
+
+		/// <summary>
+		/// Walks the whole range
+		/// </summary>
+		/// <returns>The count of tokens</returns>
+		U64 Count() const noexcept;
+
+	private:
+		bool Delimiter(C c) const noexcept { return delimiters.size ? delimiters.IndexOf(c) != -1 : c == delimiter; }
+
+		StringViewBase source;
+		StringViewBase delimiters;
+		C delimiter;
+		bool trimEntries;
+		bool skipEmpty;
+
+		friend struct StringViewBase;
+		friend struct SplitIterator;
+	};
+
+	using CharType = C;
+
+	constexpr StringViewBase() noexcept {}
+	constexpr StringViewBase(const C* string, U64 size) noexcept : string{ string }, size{ size } {}
+	constexpr StringViewBase(const C* string) noexcept;
+
+	template<Signed Arg> Arg ToType(U64 start = 0) const noexcept;
+	template<Unsigned Arg> Arg ToType(U64 start = 0) const noexcept;
+	template<Boolean Arg> Arg ToType(U64 start = 0) const noexcept;
+	template<FloatingPoint Arg> Arg ToType(U64 start = 0) const noexcept;
+
+	const C& operator[](U64 i) const noexcept { return string[i]; }
+
+	bool operator==(const StringViewBase& other) const noexcept { return Compare(other); }
+	bool operator!=(const StringViewBase& other) const noexcept { return !Compare(other); }
+
+	bool Compare(const StringViewBase& other) const noexcept;
+	bool StartsWith(const StringViewBase& other) const noexcept;
+	bool StartsWith(C c) const noexcept { return size && *string == c; }
+	bool EndsWith(const StringViewBase& other) const noexcept;
+	bool EndsWith(C c) const noexcept { return size && string[size - 1] == c; }
+
+	bool Blank() const noexcept;
+	I64 IndexOf(C find, U64 start = 0) const noexcept;
+	I64 IndexOf(const StringViewBase& find, U64 start = 0) const noexcept;
+	I64 LastIndexOf(C find) const noexcept;
+	I64 LastIndexOf(const StringViewBase& find) const noexcept;
+
+	/// <summary>
+	/// Narrows the view, clamped to its end
+	/// </summary>
+	/// <param name="start:">The first character of the new view</param>
+	/// <param name="length:">The most characters the new view has</param>
+	/// <returns>The narrower view</returns>
+	StringViewBase SubView(U64 start, U64 length = U64_MAX) const noexcept;
+	StringViewBase Trimmed() const noexcept;
+	StringViewBase TrimmedStart() const noexcept;
+	StringViewBase TrimmedEnd() const noexcept;
+
+	/// <summary>
+	/// Splits at every delimiter, "a,,b" gives "a", "" and "b"
+	/// </summary>
+	/// <param name="delimiter:">The character between tokens</param>
+	/// <param name="trimEntries:">If whitespace is trimmed off each token</param>
+	/// <returns>A range of views that finds each token as it's iterated</returns>
+	SplitRange Split(C delimiter, bool trimEntries = false) const noexcept;
+
+	/// <summary>
+	/// Splits at any of delimiters and skips empty tokens, "a  b" with " " gives "a" and "b"
+	/// </summary>
+	/// <param name="delimiters:">The characters between tokens, must outlive the range</param>
+	/// <returns>A range of views that finds each token as it's iterated</returns>
+	SplitRange Tokenize(const StringViewBase& delimiters) const noexcept;
+
+	U64 Size() const noexcept { return size; }
+	bool Empty() const noexcept { return size == 0; }
+	U64 Hash() const noexcept { return Hash::Calculate(string, size); }
+	const C* Data() const noexcept { return string; }
+
+	C Front() const noexcept { return *string; }
+	C Back() const noexcept { return string[size - 1]; }
+
+	const C* begin() const noexcept { return string; }
+	const C* end() const noexcept { return string + size; }
+
+private:
+	static U64 FindChar(const C* string, U64 size, C find) noexcept;
+	static U64 FindLastChar(const C* string, U64 size, C find) noexcept;
+	static U64 FindString(const C* string, U64 size, const C* find, U64 findSize) noexcept;
+	static bool Equal(const C* a, const C* b, U64 length) noexcept;
+
+#if defined __AVX2__
+	using CharVector = __m256i;
+
+	static CharVector Load(const C* string) noexcept { return _mm256_loadu_si256((const CharVector*)string); }
+	static CharVector Splat(C c) noexcept;
+	static U32 Matches(CharVector a, CharVector b) noexcept;
+#elif defined NH_SSE2
+	using CharVector = __m128i;
+
+	static CharVector Load(const C* string) noexcept { return _mm_loadu_si128((const CharVector*)string); }
+	static CharVector Splat(C c) noexcept;
+	static U32 Matches(CharVector a, CharVector b) noexcept;
+#endif
+
+#ifdef NH_STRING_SIMD
+	static constexpr U64 LANE_COUNT = sizeof(CharVector) / sizeof(C);
+#endif
+
+	static bool WhiteSpace(C c) noexcept;
+
+	const C* string{ nullptr };
+	U64 size{ 0 };
+};
+
+template<Character C>
+inline constexpr StringViewBase<C>::StringViewBase(const C* string) noexcept : string{ string }
+{
+	if (string) { while (string[size]) { ++size; } }
+}
+
+template<Character C>
+template<Signed Arg>
+inline Arg StringViewBase<C>::ToType(U64 start) const noexcept
+{
+	Arg value;
+	NumberText::ReadSigned(string + (start < size ? start : size), string + size, value);
+
+	return value;
+}
+
+template<Character C>
+template<Unsigned Arg>
+inline Arg StringViewBase<C>::ToType(U64 start) const noexcept
+{
+	Arg value;
+	NumberText::ReadUnsigned(string + (start < size ? start : size), string + size, value);
+
+	return value;
+}
+
+template<Character C>
+template<Boolean Arg>
+inline Arg StringViewBase<C>::ToType(U64 start) const noexcept
+{
+	return SubView(start).StartsWith(StringLookup<C>::TRUE_STR);
+}
+
+template<Character C>
+template<FloatingPoint Arg>
+inline Arg StringViewBase<C>::ToType(U64 start) const noexcept
+{
+	Arg value;
+	NumberText::ReadFloat(string + (start < size ? start : size), string + size, value);
+
+	return value;
+}
+
+template<Character C>
+inline bool StringViewBase<C>::Compare(const StringViewBase& other) const noexcept
+{
+	if (size != other.size) { return false; }
+
+	for (U64 i = 0; i < size; ++i) { if (string[i] != other.string[i]) { return false; } }
+
+	return true;
+}
+
+template<Character C>
+inline bool StringViewBase<C>::StartsWith(const StringViewBase& other) const noexcept
+{
+	return other.size <= size && StringViewBase{ string, other.size }.Compare(other);
+}
+
+template<Character C>
+inline bool StringViewBase<C>::EndsWith(const StringViewBase& other) const noexcept
+{
+	return other.size <= size && StringViewBase{ string + size - other.size, other.size }.Compare(other);
+}
+
+template<Character C>
+inline bool StringViewBase<C>::Blank() const noexcept
+{
+	for (C c : *this) { if (!WhiteSpace(c)) { return false; } }
+
+	return true;
+}
+
+template<Character C>
+inline I64 StringViewBase<C>::IndexOf(C find, U64 start) const noexcept
+{
+	if (start >= size) { return -1; }
+
+	U64 i = start + FindChar(string + start, size - start, find);
+
+	return i < size ? (I64)i : -1;
+}
+
+template<Character C>
+inline I64 StringViewBase<C>::IndexOf(const StringViewBase& find, U64 start) const noexcept
+{
+	if (start > size) { return -1; }
+
+	U64 i = start + FindString(string + start, size - start, find.string, find.size);
+
+	return i < size || (!find.size && i == size) ? (I64)i : -1;
+}
+
+template<Character C>
+inline I64 StringViewBase<C>::LastIndexOf(C find) const noexcept
+{
+	return (I64)FindLastChar(string, size, find);
+}
+
+template<Character C>
+inline I64 StringViewBase<C>::LastIndexOf(const StringViewBase& find) const noexcept
+{
+	if (find.size > size) { return -1; }
+	if (!find.size) { return (I64)size; }
+
+	//Steps back through the first character's hits, the last start that fits is size - find.size
+	U64 end = size - find.size + 1;
+
+	while (true)
+	{
+		U64 i = FindLastChar(string, end, *find.string);
+
+		if (i == U64_MAX) { return -1; }
+		if (Equal(string + i + 1, find.string + 1, find.size - 1)) { return (I64)i; }
+
+		end = i;
+	}
+}
+
+template<Character C>
+inline StringViewBase<C> StringViewBase<C>::SubView(U64 start, U64 length) const noexcept
+{
+	if (start > size) { start = size; }
+	if (length > size - start) { length = size - start; }
+
+	return { string + start, length };
+}
+
+template<Character C>
+inline StringViewBase<C> StringViewBase<C>::Trimmed() const noexcept
+{
+	return TrimmedStart().TrimmedEnd();
+}
+
+template<Character C>
+inline StringViewBase<C> StringViewBase<C>::TrimmedStart() const noexcept
+{
+	U64 start = 0;
+	while (start < size && WhiteSpace(string[start])) { ++start; }
+
+	return { string + start, size - start };
+}
+
+template<Character C>
+inline StringViewBase<C> StringViewBase<C>::TrimmedEnd() const noexcept
+{
+	U64 length = size;
+	while (length && WhiteSpace(string[length - 1])) { --length; }
+
+	return { string, length };
+}
+
+template<Character C>
+inline typename StringViewBase<C>::SplitRange StringViewBase<C>::Split(C delimiter, bool trimEntries) const noexcept
+{
+	SplitRange range;
+	range.source = *this;
+	range.delimiter = delimiter;
+	range.trimEntries = trimEntries;
+	range.skipEmpty = false;
+
+	return range;
+}
+
+template<Character C>
+inline typename StringViewBase<C>::SplitRange StringViewBase<C>::Tokenize(const StringViewBase& delimiters) const noexcept
+{
+	SplitRange range;
+	range.source = *this;
+	range.delimiters = delimiters;
+	range.delimiter = StringLookup<C>::NULL_CHAR;
+	range.trimEntries = false;
+	range.skipEmpty = true;
+
+	return range;
+}
+
+template<Character C>
+inline typename StringViewBase<C>::SplitIterator StringViewBase<C>::SplitRange::begin() const noexcept
+{
+	SplitIterator it;
+	it.range = this;
+	it.next = source.string;
+	it.more = true;
+	it.done = false;
+	it.Next();
+
+	return it;
+}
+
+template<Character C>
+inline U64 StringViewBase<C>::SplitRange::Count() const noexcept
+{
+	U64 count = 0;
+	for (SplitIterator it = begin(); it != end(); ++it) { ++count; }
+
+	return count;
+}
+
+template<Character C>
+inline void StringViewBase<C>::SplitIterator::Next() noexcept
+{
+	const StringViewBase& source = range->source;
+	const C* end = source.string + source.size;
+
+	//Empty tokens are skipped by looping
+	do
+	{
+		if (!more) { done = true; return; }
+
+		const C* it = next;
+		while (it != end && !range->Delimiter(*it)) { ++it; }
+
+		token = { next, (U64)(it - next) };
+		more = it != end;
+		next = it + more;
+
+		if (range->trimEntries) { token = token.Trimmed(); }
+	} while (range->skipEmpty && token.Empty());
+}
+
+template<Character C>
+inline U64 StringViewBase<C>::FindChar(const C* string, U64 size, C find) noexcept
+{
+	U64 i = 0;
+
+#ifdef NH_STRING_SIMD
+	CharVector target = Splat(find);
+
+	for (; i + LANE_COUNT <= size; i += LANE_COUNT)
+	{
+		U32 mask = Matches(Load(string + i), target);
+		if (mask) { return i + _tzcnt_u32(mask); }
+	}
+#endif
+
+	for (; i < size; ++i) { if (string[i] == find) { return i; } }
+
+	return size;
+}
+
+template<Character C>
+inline U64 StringViewBase<C>::FindLastChar(const C* string, U64 size, C find) noexcept
+{
+	U64 i = size;
+
+#ifdef NH_STRING_SIMD
+	CharVector target = Splat(find);
+
+	while (i >= LANE_COUNT)
+	{
+		i -= LANE_COUNT;
+
+		U32 mask = Matches(Load(string + i), target);
+
+		unsigned long bit;
+		if (_BitScanReverse(&bit, mask)) { return i + bit; }
+	}
+#endif
+
+	while (i--) { if (string[i] == find) { return i; } }
+
+	return U64_MAX;
+}
+
+template<Character C>
+inline U64 StringViewBase<C>::FindString(const C* string, U64 size, const C* find, U64 findSize) noexcept
+{
+	if (findSize == 0) { return 0; }
+	if (findSize == 1) { return FindChar(string, size, *find); }
+	if (findSize > size) { return size; }
+
+	const U64 last = size - findSize;
+	const C first = find[0];
+	const C final = find[findSize - 1];
+	U64 i = 0;
+
+#ifdef NH_STRING_SIMD
+	//Both loads stay inside the string while every start in the register is at or before last
+	CharVector firsts = Splat(first);
+	CharVector finals = Splat(final);
+
+	for (; i + LANE_COUNT - 1 <= last; i += LANE_COUNT)
+	{
+		U32 mask = Matches(Load(string + i), firsts) & Matches(Load(string + i + findSize - 1), finals);
+
+		while (mask)
+		{
+			U64 index = i + _tzcnt_u32(mask);
+			if (Equal(string + index + 1, find + 1, findSize - 2)) { return index; }
+
+			mask &= mask - 1;
+		}
+	}
+#endif
+
+	for (; i <= last; ++i)
+	{
+		if (string[i] == first && string[i + findSize - 1] == final && Equal(string + i + 1, find + 1, findSize - 2)) { return i; }
+	}
+
+	return size;
+}
+
+template<Character C>
+inline bool StringViewBase<C>::Equal(const C* a, const C* b, U64 length) noexcept
+{
+	for (U64 i = 0; i < length; ++i) { if (a[i] != b[i]) { return false; } }
+
+	return true;
+}
+
+#if defined __AVX2__
+template<Character C>
+inline typename StringViewBase<C>::CharVector StringViewBase<C>::Splat(C c) noexcept
+{
+	if constexpr (sizeof(C) == 1) { return _mm256_set1_epi8((char)c); }
+	else if constexpr (sizeof(C) == 2) { return _mm256_set1_epi16((short)c); }
+	else { return _mm256_set1_epi32((int)c); }
+}
+
+//One bit per matching character
+template<Character C>
+inline U32 StringViewBase<C>::Matches(CharVector a, CharVector b) noexcept
+{
+	if constexpr (sizeof(C) == 1) { return (U32)_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)); }
+	else if constexpr (sizeof(C) == 2)
+	{
+		//Packing works within each half, the permute brings both halves' bytes to the bottom
+		CharVector packed = _mm256_packs_epi16(_mm256_cmpeq_epi16(a, b), _mm256_setzero_si256());
+		return (U32)_mm256_movemask_epi8(_mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0))) & 0xFFFF;
+	}
+	else { return (U32)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(a, b))); }
+}
+#elif defined NH_SSE2
+template<Character C>
+inline typename StringViewBase<C>::CharVector StringViewBase<C>::Splat(C c) noexcept
+{
+	if constexpr (sizeof(C) == 1) { return _mm_set1_epi8((char)c); }
+	else if constexpr (sizeof(C) == 2) { return _mm_set1_epi16((short)c); }
+	else { return _mm_set1_epi32((int)c); }
+}
+
+//One bit per matching character
+template<Character C>
+inline U32 StringViewBase<C>::Matches(CharVector a, CharVector b) noexcept
+{
+	if constexpr (sizeof(C) == 1) { return (U32)_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)); }
+	else if constexpr (sizeof(C) == 2) { return (U32)_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(a, b), _mm_setzero_si128())); }
+	else { return (U32)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))); }
+}
+#endif
+
+template<Character C>
+inline bool StringViewBase<C>::WhiteSpace(C c) noexcept
+{
+	return c == StringLookup<C>::SPACE || c == StringLookup<C>::HTAB || c == StringLookup<C>::VTAB ||
+		c == StringLookup<C>::NEW_LINE || c == StringLookup<C>::RETURN || c == StringLookup<C>::FEED;
+}
\ No newline at end of file
@@ -3,29 +3,19 @@
 #include "ContainerDefines.hpp"
 
 #include "Memory\Memory.hpp"
+#include "Math\Hash.hpp"
+#include "Platform\Jobs.hpp"
+
+inline constexpr U64 SORT_INSERTION_MAX = 32; //Ranges this small are insertion sorted
+inline constexpr U64 SORT_PARALLEL_MIN = 65536; //ParallelSort falls back to StableSort below this
+inline constexpr U32 SORT_PARALLEL_RUNS = 64; //Power of two, runs sorted at once and merge jobs per pass
+inline constexpr U64 SET_LINEAR_MAX = 256; //Set operations compare every pair while size times other size is at most this, past it hashable types hash
 
 /*
 * TODO: Variatic Templates
 *	Insert
 *	Merge
 *	Add
-*
-* TODO: Sorting
-*	Comparison Predicate
-*
-* TODO: Comparison
-*	Compare two Vectors, return true if matching
-*	Compare two Vectors, return count of matching
-*	Compare two Vectors, return Vector<T> of matching
-*	Compare two Vectors, remove matching, return count
-*	Compare two Vectors, merge all unique values
-*
-* TODO: Insertion
-*	Push value if unique
-*	Insert value if unique
-*
-* TODO: Remove
-*	Search, remove all non-unique values
 */
 template<typename T>
 struct Vector
@@ -292,6 +282,46 @@ public:
 
 
 
+	/// <summary>
+	/// Sorts array with introsort, quicksort on a median of three that turns to heapsort if it recurses too deep, small ranges are insertion sorted
+	/// WARNING: not stable, equal values may change order
+	/// </summary>
+	/// <param name="predicate:">A function to order values: bool pred(const T& a, const T& b), true if a goes before b</param>
+	template<typename Predicate> void Sort(Predicate predicate);
+
+	/// <summary>
+	/// Sorts array in ascending order with introsort using operator&lt;
+	/// WARNING: not stable, equal values may change order
+	/// </summary>
+	void Sort();
+
+	/// <summary>
+	/// Sorts array with a bottom up merge sort, equal values keep their order, allocates a buffer the size of array
+	/// </summary>
+	/// <param name="predicate:">A function to order values: bool pred(const T& a, const T& b), true if a goes before b</param>
+	template<typename Predicate> void StableSort(Predicate predicate);
+
+	/// <summary>
+	/// Sorts array with an LSD radix sort by key, one pass per byte of the key, bytes that are the same for every value are skipped, stable
+	/// </summary>
+	/// <param name="key:">A function to get a value's key, any integer or float type: Key key(const T& value)</param>
+	template<typename KeyFunc> void RadixSort(KeyFunc key);
+
+	/// <summary>
+	/// Sorts array of integers or floats in ascending order with an LSD radix sort
+	/// </summary>
+	void RadixSort();
+
+	/// <summary>
+	/// Sorts array with a merge sort spread over Jobs, SORT_PARALLEL_RUNS runs are sorted at once, then each merge pass is split
+	/// into even pieces of output by binary searching where they start in both runs, equal values keep their order
+	/// WARNING: waits on Jobs, don't call from inside a job
+	/// </summary>
+	/// <param name="predicate:">A function to order values: bool pred(const T& a, const T& b), true if a goes before b</param>
+	template<typename Predicate> void ParallelSort(Predicate predicate);
+
+
+
 	/// <summary>
 	/// Reallocates the array to be sizeof(T) * capacity
 	/// </summary>
@@ -339,6 +369,69 @@ public:
 	/// <returns>The index of value, if it doesn't find value, U64_MAX</returns>
 	U64 Find(const T& value) const;
 
+	/// <summary>
+	/// Counts the values in array that are also in other, large inputs look values up in a hashed index of other
+	/// </summary>
+	/// <param name="other:">The Vector to compare against</param>
+	/// <returns>The count of values in array found in other</returns>
+	U64 CountMatches(const Vector& other) const;
+
+	/// <summary>
+	/// Finds the values in array that are also in other, fills result with them in the order of array
+	/// WARNING: any previous data in result will be lost
+	/// </summary>
+	/// <param name="other:">The Vector to compare against</param>
+	/// <param name="result:">A Vector to fill with values</param>
+	void Matches(const Vector& other, Vector& result) const;
+
+	/// <summary>
+	/// Removes the values in array that are also in other, the rest keep their order
+	/// </summary>
+	/// <param name="other:">The Vector to compare against</param>
+	/// <returns>The count of values removed</returns>
+	U64 RemoveMatches(const Vector& other);
+
+	/// <summary>
+	/// Copies the values in other that aren't in array yet to the end of array, duplicates within other are added once
+	/// </summary>
+	/// <param name="other:">The Vector to copy from</param>
+	void MergeUnique(const Vector& other);
+
+	/// <summary>
+	/// Moves the values in other that aren't in array yet to the end of array, duplicates within other are added once
+	/// WARNING: other will be destroyed
+	/// </summary>
+	/// <param name="other:">The Vector to move</param>
+	void MergeUnique(Vector&& other) noexcept;
+
+	/// <summary>
+	/// Puts value onto the back of array if array doesn't contain it
+	/// </summary>
+	/// <param name="value:">The value to copy</param>
+	/// <returns>true if value was added, false otherwise</returns>
+	bool PushUnique(const T& value);
+
+	/// <summary>
+	/// Moves value onto the back of array if array doesn't contain it
+	/// </summary>
+	/// <param name="value:">The value to move</param>
+	/// <returns>true if value was added, false otherwise</returns>
+	bool PushUnique(T&& value) noexcept;
+
+	/// <summary>
+	/// Inserts value into index if array doesn't contain it, moves values at and past index over
+	/// </summary>
+	/// <param name="index:">The index to put value</param>
+	/// <param name="value:">The value to copy</param>
+	/// <returns>true if value was added, false otherwise</returns>
+	bool InsertUnique(U64 index, const T& value);
+
+	/// <summary>
+	/// Removes every value that equals one before it, the first of each value keeps its place
+	/// </summary>
+	/// <returns>The count of values removed</returns>
+	U64 RemoveDuplicates();
+
 
 
 	/// <summary></summary>
@@ -428,6 +521,25 @@ public:
 	const T* end() const { return array + size; }
 
 private:
+	template<typename Predicate> static void IntroSort(T* first, T* last, U64 depth, Predicate& predicate);
+	template<typename Predicate> static void InsertionSort(T* first, T* last, Predicate& predicate);
+	template<typename Predicate> static void HeapSort(T* first, T* last, Predicate& predicate);
+	template<typename Predicate> static void SiftDown(T* heap, U64 index, U64 count, Predicate& predicate);
+	template<typename Predicate> static void MergeSort(T* data, T* buffer, U64 count, Predicate& predicate);
+	template<typename Predicate> static void MergeRuns(const T* left, U64 leftCount, const T* right, U64 rightCount, T* out, Predicate& predicate);
+	template<typename Predicate> static U64 MergeSplit(U64 k, const T* left, U64 leftCount, const T* right, U64 rightCount, Predicate& predicate);
+	template<typename Key> static U64 RadixKey(Key key);
+
+	/// <summary>
+	/// Whether equal values always hash the same, set operations on anything else stay on pairwise compares
+	/// </summary>
+	static constexpr bool HASHABLE = requires(const T& v) { v.Hash(); } || IsInteger<T> || IsCharacter<T> || IsBoolean<T> || IsEnum<T> || IsPointer<T> || IsFloatingPoint<T>;
+
+	static U64 HashValue(const T& value);
+	static U64* BuildIndex(const T* values, U64 count, U64 capacity, U64& mask);
+	static U64* IndexSlot(U64* table, U64 mask, const T* values, const T& value);
+
+	template<typename, U64> friend struct SmallVector;
 
 	/// <summary>
 	/// The count of values inside array
@@ -767,6 +879,367 @@ inline bool Vector<T>::Find(Predicate predicate, T& value)
 	return false;
 }
 
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::Sort(Predicate predicate)
+{
+	//Twice the depth a balanced quicksort would reach before giving up on it
+	U64 depth = 0;
+	for (U64 n = size; n > 1; n >>= 1) { depth += 2; }
+
+	IntroSort(array, array + size, depth, predicate);
+}
+
+template<typename T>
+inline void Vector<T>::Sort()
+{
+	Sort([](const T& a, const T& b) { return a < b; });
+}
+
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::StableSort(Predicate predicate)
+{
+	if (size < 2) { return; }
+
+	T* buffer;
+	Memory::AllocateArray(&buffer, size);
+
+	MergeSort(array, buffer, size, predicate);
+
+	Memory::Free(&buffer);
+}
+
+template<typename T>
+template<typename KeyFunc>
+inline void Vector<T>::RadixSort(KeyFunc key)
+{
+	using Key = RemovedQuals<RemovedReference<decltype(key(*array))>>;
+	constexpr U64 passes = sizeof(Key);
+
+	if (size < 2) { return; }
+
+	T* buffer;
+	U64* keys;
+	U64* keyBuffer;
+	Memory::AllocateArray(&buffer, size);
+	Memory::AllocateArray(&keys, size);
+	Memory::AllocateArray(&keyBuffer, size);
+
+	//Every pass's histogram comes from one read of the keys
+	U64 counts[passes][256]{};
+
+	for (U64 i = 0; i < size; ++i)
+	{
+		keys[i] = RadixKey(key(array[i]));
+		for (U64 pass = 0; pass < passes; ++pass) { ++counts[pass][(keys[i] >> (pass * 8)) & 0xFF]; }
+	}
+
+	T* from = array;
+	T* to = buffer;
+	U64* fromKeys = keys;
+	U64* toKeys = keyBuffer;
+
+	for (U64 pass = 0; pass < passes; ++pass)
+	{
+		U64* count = counts[pass];
+		U64 shift = pass * 8;
+
+		if (count[(fromKeys[0] >> shift) & 0xFF] == size) { continue; }
+
+		U64 offset = 0;
+		for (U64 digit = 0; digit < 256; ++digit)
+		{
+			U64 digitCount = count[digit];
+			count[digit] = offset;
+			offset += digitCount;
+		}
+
+		for (U64 i = 0; i < size; ++i)
+		{
+			U64 index = count[(fromKeys[i] >> shift) & 0xFF]++;
+			to[index] = from[i];
+			toKeys[index] = fromKeys[i];
+		}
+
+		Swap(from, to);
+		Swap(fromKeys, toKeys);
+	}
+
+	if (from != array) { Memory::Copy(array, from, sizeof(T) * size); }
+
+	Memory::Free(&buffer);
+	Memory::Free(&keys);
+	Memory::Free(&keyBuffer);
+}
+
+template<typename T>
+inline void Vector<T>::RadixSort()
+{
+	RadixSort([](const T& value) { return value; });
+}
+
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::ParallelSort(Predicate predicate)
+{
+	if (size < SORT_PARALLEL_MIN) { StableSort(predicate); return; }
+
+	T* buffer;
+	Memory::AllocateArray(&buffer, size);
+
+	T* data = array;
+	const U64 count = size;
+	const U64 runSize = (count + SORT_PARALLEL_RUNS - 1) / SORT_PARALLEL_RUNS;
+
+	Jobs::Dispatch(SORT_PARALLEL_RUNS, 1, [&](JobDispatchArgs args) {
+		U64 first = args.jobIndex * runSize;
+		if (first >= count) { return; }
+
+		U64 last = first + runSize < count ? first + runSize : count;
+		MergeSort(data + first, buffer + first, last - first, predicate);
+	});
+
+	Jobs::Wait();
+
+	T* from = data;
+	T* to = buffer;
+
+	//Fewer pairs each pass, so each pair gets split into more pieces to keep every job busy
+	for (U64 width = runSize; width < count; width *= 2)
+	{
+		const U64 pairSize = width * 2;
+		const U64 pairCount = (count + pairSize - 1) / pairSize;
+		const U64 pieces = pairCount < SORT_PARALLEL_RUNS ? SORT_PARALLEL_RUNS / pairCount : 1;
+
+		Jobs::Dispatch((U32)(pairCount * pieces), 1, [&](JobDispatchArgs args) {
+			U64 start = (args.jobIndex / pieces) * pairSize;
+			U64 piece = args.jobIndex % pieces;
+			U64 middle = start + width < count ? start + width : count;
+			U64 end = start + pairSize < count ? start + pairSize : count;
+
+			const T* left = from + start;
+			const T* right = from + middle;
+			U64 leftCount = middle - start;
+			U64 rightCount = end - middle;
+
+			U64 k0 = (end - start) * piece / pieces;
+			U64 k1 = (end - start) * (piece + 1) / pieces;
+			U64 i0 = MergeSplit(k0, left, leftCount, right, rightCount, predicate);
+			U64 i1 = MergeSplit(k1, left, leftCount, right, rightCount, predicate);
+
+			MergeRuns(left + i0, i1 - i0, right + (k0 - i0), (k1 - i1) - (k0 - i0), to + start + k0, predicate);
+		});
+
+		Jobs::Wait();
+
+		Swap(from, to);
+	}
+
+	if (from != data) { Memory::Copy(data, from, sizeof(T) * count); }
+
+	Memory::Free(&buffer);
+}
+
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::IntroSort(T* first, T* last, U64 depth, Predicate& predicate)
+{
+	while ((U64)(last - first) > SORT_INSERTION_MAX)
+	{
+		if (depth == 0) { HeapSort(first, last, predicate); return; }
+		--depth;
+
+		//Median of three, the largest stays at the back so the left scan always stops
+		T* middle = first + (last - first) / 2;
+		T* back = last - 1;
+
+		if (predicate(*middle, *first)) { Swap(*middle, *first); }
+		if (predicate(*back, *middle))
+		{
+			Swap(*back, *middle);
+			if (predicate(*middle, *first)) { Swap(*middle, *first); }
+		}
+
+		Swap(*first, *middle);
+
+		T* i = first;
+		T* j = last;
+
+		while (true)
+		{
+			do { ++i; } while (predicate(*i, *first));
+			do { --j; } while (predicate(*first, *j));
+
+			if (i >= j) { break; }
+
+			Swap(*i, *j);
+		}
+
+		Swap(*first, *j);
+
+		//Recursing into the smaller side keeps the stack at log n
+		if (j - first < last - j - 1)
+		{
+			IntroSort(first, j, depth, predicate);
+			first = j + 1;
+		}
+		else
+		{
+			IntroSort(j + 1, last, depth, predicate);
+			last = j;
+		}
+	}
+
+	InsertionSort(first, last, predicate);
+}
+
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::InsertionSort(T* first, T* last, Predicate& predicate)
+{
+	if (last - first < 2) { return; }
+
+	for (T* t = first + 1; t < last; ++t)
+	{
+		if (!predicate(*t, *(t - 1))) { continue; }
+
+		T value = Move(*t);
+		T* hole = t;
+
+		do
+		{
+			*hole = Move(*(hole - 1));
+			--hole;
+		} while (hole != first && predicate(value, *(hole - 1)));
+
+		*hole = Move(value);
+	}
+}
+
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::HeapSort(T* first, T* last, Predicate& predicate)
+{
+	U64 count = last - first;
+
+	for (U64 i = count / 2; i-- > 0;) { SiftDown(first, i, count, predicate); }
+
+	for (U64 end = count - 1; end > 0; --end)
+	{
+		Swap(first[0], first[end]);
+		SiftDown(first, 0, end, predicate);
+	}
+}
+
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::SiftDown(T* heap, U64 index, U64 count, Predicate& predicate)
+{
+	while (true)
+	{
+		U64 child = index * 2 + 1;
+		if (child >= count) { return; }
+
+		if (child + 1 < count && predicate(heap[child], heap[child + 1])) { ++child; }
+		if (!predicate(heap[index], heap[child])) { return; }
+
+		Swap(heap[index], heap[child]);
+		index = child;
+	}
+}
+
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::MergeSort(T* data, T* buffer, U64 count, Predicate& predicate)
+{
+	for (U64 i = 0; i < count; i += SORT_INSERTION_MAX)
+	{
+		InsertionSort(data + i, data + (i + SORT_INSERTION_MAX < count ? i + SORT_INSERTION_MAX : count), predicate);
+	}
+
+	//Bottom up, each pass merges pairs of runs into the other array
+	T* from = data;
+	T* to = buffer;
+
+	for (U64 width = SORT_INSERTION_MAX; width < count; width *= 2)
+	{
+		for (U64 i = 0; i < count; i += width * 2)
+		{
+			U64 middle = i + width < count ? i + width : count;
+			U64 end = i + width * 2 < count ? i + width * 2 : count;
+
+			MergeRuns(from + i, middle - i, from + middle, end - middle, to + i, predicate);
+		}
+
+		Swap(from, to);
+	}
+
+	if (from != data) { Memory::Copy(data, from, sizeof(T) * count); }
+}
+
+template<typename T>
+template<typename Predicate>
+inline void Vector<T>::MergeRuns(const T* left, U64 leftCount, const T* right, U64 rightCount, T* out, Predicate& predicate)
+{
+	const T* leftEnd = left + leftCount;
+	const T* rightEnd = right + rightCount;
+
+	//Ties go to the left run, that's what keeps it stable
+	while (left != leftEnd && right != rightEnd) { *out++ = predicate(*right, *left) ? *right++ : *left++; }
+
+	if (left != leftEnd) { Memory::Copy(out, left, sizeof(T) * (leftEnd - left)); }
+	if (right != rightEnd) { Memory::Copy(out, right, sizeof(T) * (rightEnd - right)); }
+}
+
+template<typename T>
+template<typename Predicate>
+inline U64 Vector<T>::MergeSplit(U64 k, const T* left, U64 leftCount, const T* right, U64 rightCount, Predicate& predicate)
+{
+	//How many of the first k merged values come from left, found by binary search
+	U64 low = k > rightCount ? k - rightCount : 0;
+	U64 high = k < leftCount ? k : leftCount;
+
+	while (low < high)
+	{
+		U64 i = (low + high) / 2;
+		U64 j = k - i;
+
+		if (j > 0 && !predicate(right[j - 1], left[i])) { low = i + 1; }
+		else { high = i; }
+	}
+
+	return low;
+}
+
+template<typename T>
+template<typename Key>
+inline U64 Vector<T>::RadixKey(Key key)
+{
+	//Maps each key type to an unsigned value that sorts the same way
+	if constexpr (IsFloatingPoint<Key>)
+	{
+		if constexpr (sizeof(Key) == 4)
+		{
+			U32 bits = *(U32*)&key;
+			return bits ^ ((bits >> 31) ? 0xFFFFFFFFu : 0x80000000u);
+		}
+		else
+		{
+			U64 bits = *(U64*)&key;
+			return bits ^ ((bits >> 63) ? U64_MAX : 0x8000000000000000ull);
+		}
+	}
+	else
+	{
+		constexpr U64 bits = sizeof(Key) * 8;
+		constexpr U64 mask = bits == 64 ? U64_MAX : (1ull << bits) - 1;
+
+		if constexpr (IsSigned<Key>) { return ((U64)key & mask) ^ (1ull << (bits - 1)); }
+		else { return (U64)key & mask; }
+	}
+}
+
 template<typename T> 
 inline void Vector<T>::Reserve(U64 capacity)
 {
@@ -824,6 +1297,262 @@ inline U64 Vector<T>::Find(const T& value) const
 	return -1;
 }
 
+template<typename T>
+inline U64 Vector<T>::CountMatches(const Vector& other) const
+{
+	U64 count = 0;
+
+	if (!HASHABLE || size * other.size <= SET_LINEAR_MAX)
+	{
+		for (T* t = array, *end = array + size; t != end; ++t) { count += other.Contains(*t); }
+
+		return count;
+	}
+
+	U64 mask;
+	U64* table = BuildIndex(other.array, other.size, other.size, mask);
+
+	for (T* t = array, *end = array + size; t != end; ++t) { count += *IndexSlot(table, mask, other.array, *t) != 0; }
+
+	Memory::Free(&table);
+
+	return count;
+}
+
+template<typename T>
+inline void Vector<T>::Matches(const Vector& other, Vector& result) const
+{
+	result.size = 0;
+	if (result.capacity < size) { result.Reserve(size); }
+
+	if (!HASHABLE || size * other.size <= SET_LINEAR_MAX)
+	{
+		for (T* t = array, *end = array + size; t != end; ++t)
+		{
+			if (other.Contains(*t)) { result.array[result.size++] = *t; }
+		}
+
+		return;
+	}
+
+	U64 mask;
+	U64* table = BuildIndex(other.array, other.size, other.size, mask);
+
+	for (T* t = array, *end = array + size; t != end; ++t)
+	{
+		if (*IndexSlot(table, mask, other.array, *t)) { result.array[result.size++] = *t; }
+	}
+
+	Memory::Free(&table);
+}
+
+template<typename T>
+inline U64 Vector<T>::RemoveMatches(const Vector& other)
+{
+	T* out = array;
+
+	if (!HASHABLE || size * other.size <= SET_LINEAR_MAX)
+	{
+		for (T* t = array, *end = array + size; t != end; ++t)
+		{
+			if (other.Contains(*t)) { continue; }
+			if (out != t) { *out = Move(*t); }
+			++out;
+		}
+	}
+	else
+	{
+		U64 mask;
+		U64* table = BuildIndex(other.array, other.size, other.size, mask);
+
+		for (T* t = array, *end = array + size; t != end; ++t)
+		{
+			if (*IndexSlot(table, mask, other.array, *t)) { continue; }
+			if (out != t) { *out = Move(*t); }
+			++out;
+		}
+
+		Memory::Free(&table);
+	}
+
+	U64 removed = size - (out - array);
+	size = out - array;
+
+	return removed;
+}
+
+template<typename T>
+inline void Vector<T>::MergeUnique(const Vector& other)
+{
+	if (size + other.size > capacity) { Reserve(size + other.size); }
+
+	if (!HASHABLE || (size + other.size) * other.size <= SET_LINEAR_MAX)
+	{
+		for (T* t = other.array, *end = other.array + other.size; t != end; ++t)
+		{
+			if (!Contains(*t)) { array[size++] = *t; }
+		}
+
+		return;
+	}
+
+	//The index covers array as it grows, so repeats within other are caught too
+	U64 mask;
+	U64* table = BuildIndex(array, size, size + other.size, mask);
+
+	for (T* t = other.array, *end = other.array + other.size; t != end; ++t)
+	{
+		U64* slot = IndexSlot(table, mask, array, *t);
+		if (*slot) { continue; }
+
+		array[size] = *t;
+		*slot = ++size;
+	}
+
+	Memory::Free(&table);
+}
+
+template<typename T>
+inline void Vector<T>::MergeUnique(Vector&& other) noexcept
+{
+	if (size + other.size > capacity) { Reserve(size + other.size); }
+
+	if (!HASHABLE || (size + other.size) * other.size <= SET_LINEAR_MAX)
+	{
+		for (T* t = other.array, *end = other.array + other.size; t != end; ++t)
+		{
+			if (!Contains(*t)) { array[size++] = Move(*t); }
+		}
+	}
+	else
+	{
+		U64 mask;
+		U64* table = BuildIndex(array, size, size + other.size, mask);
+
+		for (T* t = other.array, *end = other.array + other.size; t != end; ++t)
+		{
+			U64* slot = IndexSlot(table, mask, array, *t);
+			if (*slot) { continue; }
+
+			array[size] = Move(*t);
+			*slot = ++size;
+		}
+
+		Memory::Free(&table);
+	}
+
+	other.Destroy();
+}
+
+template<typename T>
+inline bool Vector<T>::PushUnique(const T& value)
+{
+	if (Contains(value)) { return false; }
+
+	Push(value);
+	return true;
+}
+
+template<typename T>
+inline bool Vector<T>::PushUnique(T&& value) noexcept
+{
+	if (Contains(value)) { return false; }
+
+	Push(Move(value));
+	return true;
+}
+
+template<typename T>
+inline bool Vector<T>::InsertUnique(U64 index, const T& value)
+{
+	if (Contains(value)) { return false; }
+
+	Insert(index, value);
+	return true;
+}
+
+template<typename T>
+inline U64 Vector<T>::RemoveDuplicates()
+{
+	if (size < 2) { return 0; }
+
+	T* out = array;
+
+	if (!HASHABLE || size * size <= SET_LINEAR_MAX)
+	{
+		for (T* t = array, *end = array + size; t != end; ++t)
+		{
+			bool repeat = false;
+			for (T* kept = array; kept != out && !repeat; ++kept) { repeat = *kept == *t; }
+
+			if (repeat) { continue; }
+			if (out != t) { *out = Move(*t); }
+			++out;
+		}
+	}
+	else
+	{
+		//Only kept values are indexed, they're already in their final place
+		U64 mask;
+		U64* table = BuildIndex(array, 0, size, mask);
+
+		for (T* t = array, *end = array + size; t != end; ++t)
+		{
+			U64* slot = IndexSlot(table, mask, array, *t);
+			if (*slot) { continue; }
+
+			if (out != t) { *out = Move(*t); }
+			*slot = ++out - array;
+		}
+
+		Memory::Free(&table);
+	}
+
+	U64 removed = size - (out - array);
+	size = out - array;
+
+	return removed;
+}
+
+template<typename T>
+inline U64 Vector<T>::HashValue(const T& value)
+{
+	if constexpr (requires(const T& v) { v.Hash(); }) { return value.Hash(); }
+	else if constexpr (IsPointer<T>) { return Hash::Calculate((U64)value); }
+	else if constexpr (IsFloatingPoint<T>) { return Hash::Calculate(value == 0 ? T{} : value); } //-0 and 0 compare equal
+	else { return Hash::Calculate(value); }
+}
+
+template<typename T>
+inline U64* Vector<T>::BuildIndex(const T* values, U64 count, U64 capacity, U64& mask)
+{
+	//Open addressing at under half load, slots hold index + 1 so zero is empty
+	U64 slots = 16;
+	while (slots < capacity * 2) { slots <<= 1; }
+	mask = slots - 1;
+
+	U64* table;
+	Memory::AllocateArray(&table, slots);
+	Memory::Zero(table, sizeof(U64) * slots);
+
+	for (U64 i = 0; i < count; ++i)
+	{
+		U64* slot = IndexSlot(table, mask, values, values[i]);
+		if (!*slot) { *slot = i + 1; }
+	}
+
+	return table;
+}
+
+template<typename T>
+inline U64* Vector<T>::IndexSlot(U64* table, U64 mask, const T* values, const T& value)
+{
+	U64 i = HashValue(value) & mask;
+	while (table[i] && !(values[table[i] - 1] == value)) { i = (i + 1) & mask; }
+
+	return table + i;
+}
+
 template<typename T>
 inline bool Vector<T>::operator==(const Vector& other) const
 {
@@ -831,7 +1560,7 @@ inline bool Vector<T>::operator==(const Vector& other) const
 
 	for (T* it0 = array, *it1 = other.array, *end = array + size; it0 != end; ++it0, ++it1)
 	{
-		if (*it0 != *it0) { return false; }
+		if (*it0 != *it1) { return false; }
 	}
 
 	return true;
@@ -844,7 +1573,7 @@ inline bool Vector<T>::operator!=(const Vector& other) const
 
 	for (T* it0 = array, *it1 = other.array, *end = array + size; it0 != end; ++it0, ++it1)
 	{
-		if (*it0 != *it0) { return true; }
+		if (*it0 != *it1) { return true; }
 	}
 
 	return false;
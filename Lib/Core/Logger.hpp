@@ -28,12 +28,12 @@ struct File;
 class NH_API Logger
 {
 public:
-	template<Character T, typename... Types> static void Fatal(const T* message, const Types&... args);
-	template<Character T, typename... Types> static void Error(const T* message, const Types&... args);
-	template<Character T, typename... Types> static void Warn(const T* message, const Types&... args);
-	template<Character T, typename... Types> static void Info(const T* message, const Types&... args);
-	template<Character T, typename... Types> static void Debug(const T* message, const Types&... args);
-	template<Character T, typename... Types> static void Trace(const T* message, const Types&... args);
+	template<typename... Types> static void Fatal(FormatString<Types...> message, const Types&... args);
+	template<typename... Types> static void Error(FormatString<Types...> message, const Types&... args);
+	template<typename... Types> static void Warn(FormatString<Types...> message, const Types&... args);
+	template<typename... Types> static void Info(FormatString<Types...> message, const Types&... args);
+	template<typename... Types> static void Debug(FormatString<Types...> message, const Types&... args);
+	template<typename... Types> static void Trace(FormatString<Types...> message, const Types&... args);
 	template<typename Type> static void Fatal(const Type& arg);
 	template<typename Type> static void Error(const Type& arg);
 	template<typename Type> static void Warn(const Type& arg);
@@ -53,63 +53,69 @@ private:
 	friend class Engine;
 };
 
-template<Character T, typename... Types> inline void Logger::Fatal(const T* message, const Types&... args)
+template<typename... Types> inline void Logger::Fatal(FormatString<Types...> message, const Types&... args)
 {
-	String str{ FATAL_TAG };
+	String str;
+	str.Reserve(CountOf(FATAL_TAG) + message.Capacity(args...) + CountOf(END_LINE));
 
-	str.Format(CountOf(FATAL_TAG), message, args...);
+	str.Append(FATAL_TAG).Format(CountOf(FATAL_TAG) - 1, message, args...);
 	
 	Write(str.Append(END_LINE));
 }
 
-template<Character T, typename... Types> inline void Logger::Error(const T* message, const Types&... args)
+template<typename... Types> inline void Logger::Error(FormatString<Types...> message, const Types&... args)
 {
-	String str{ ERROR_TAG };
+	String str;
+	str.Reserve(CountOf(ERROR_TAG) + message.Capacity(args...) + CountOf(END_LINE));
 
-	str.Format(CountOf(ERROR_TAG), message, args...);
+	str.Append(ERROR_TAG).Format(CountOf(ERROR_TAG) - 1, message, args...);
 
 	Write(str.Append(END_LINE));
 }
 
-template<Character T, typename... Types> inline void Logger::Warn(const T* message, const Types&... args)
+template<typename... Types> inline void Logger::Warn(FormatString<Types...> message, const Types&... args)
 {
 #if LOG_WARN_ENABLED
-	String str{ WARN_TAG };
+	String str;
+	str.Reserve(CountOf(WARN_TAG) + message.Capacity(args...) + CountOf(END_LINE));
 
-	str.Format(CountOf(WARN_TAG), message, args...);
+	str.Append(WARN_TAG).Format(CountOf(WARN_TAG) - 1, message, args...);
 
 	Write(str.Append(END_LINE));
 #endif
 }
 
-template<Character T, typename... Types> inline void Logger::Info(const T* message, const Types&... args)
+template<typename... Types> inline void Logger::Info(FormatString<Types...> message, const Types&... args)
 {
 #if LOG_INFO_ENABLED
-	String str{ INFO_TAG };
+	String str;
+	str.Reserve(CountOf(INFO_TAG) + message.Capacity(args...) + CountOf(END_LINE));
 
-	str.Format(CountOf(INFO_TAG), message, args...);
+	str.Append(INFO_TAG).Format(CountOf(INFO_TAG) - 1, message, args...);
 
 	Write(str.Append(END_LINE));
 #endif
 }
 
-template<Character T, typename... Types> inline void Logger::Debug(const T* message, const Types&... args)
+template<typename... Types> inline void Logger::Debug(FormatString<Types...> message, const Types&... args)
 {
 #if LOG_DEBUG_ENABLED
-	String str{ DEBUG_TAG };
+	String str;
+	str.Reserve(CountOf(DEBUG_TAG) + message.Capacity(args...) + CountOf(END_LINE));
 
-	str.Format(CountOf(DEBUG_TAG), message, args...);
+	str.Append(DEBUG_TAG).Format(CountOf(DEBUG_TAG) - 1, message, args...);
 
 	Write(str.Append(END_LINE));
 #endif
 }
 
-template<Character T, typename... Types> inline void Logger::Trace(const T* message, const Types&... args)
+template<typename... Types> inline void Logger::Trace(FormatString<Types...> message, const Types&... args)
 {
 #if LOG_TRACE_ENABLED
-	String str{ TRACE_TAG };
+	String str;
+	str.Reserve(CountOf(TRACE_TAG) + message.Capacity(args...) + CountOf(END_LINE));
 
-	str.Format(CountOf(TRACE_TAG), message, args...);
+	str.Append(TRACE_TAG).Format(CountOf(TRACE_TAG) - 1, message, args...);
 
 	Write(str.Append(END_LINE));
 #endif
@@ -23,7 +23,7 @@ typedef __m256i I256;
 
 inline static const F256 ZeroF256 = _mm256_setzero_ps();
 inline static const D256 ZeroD256 = _mm256_setzero_pd();
-inline static const D256 ZeroI256 = _mm256_setzero_si256();
+inline static const I256 ZeroI256 = _mm256_setzero_si256();
 
 #elif defined NH_SSE || defined NH_SSE2
 
@@ -8,6 +8,9 @@ template <class Type> concept Class = IsClass<Type>;
 template <class Type> inline constexpr bool IsUnion = __is_union(Type);
 template <class Type> concept Union = IsUnion<Type>;
 
+template <class Type> inline constexpr bool IsEnum = __is_enum(Type);
+template <class Type> concept Enum = IsEnum<Type>;
+
 template <class Type> inline constexpr bool IsNothrowMoveConstructible = __is_nothrow_constructible(Type, Type);
 template <class Type> concept NothrowMoveConstructible = IsNothrowMoveConstructible<Type>;
 
@@ -54,6 +57,8 @@ template <class Type> inline constexpr bool IsConstVolatile<const volatile Type>
 
 namespace TypeTraits
 {
+	template <class Type> struct Identity { using type = Type; };
+
 	template <class Type> struct RemoveConst { using type = Type; };
 	template <class Type> struct RemoveConst<const Type> { using type = Type; };
 
@@ -178,6 +183,7 @@ using Enable = typename TypeTraits::EnableIf<Test, Type>::type;
 template<class Type, class... Rest>
 inline constexpr bool AnyOf = TypeTraits::IsAnyOf<Type, Rest...>::value;
 
+template <class Type> using TypeIdentity = typename TypeTraits::Identity<Type>::type;
 template <class Type> using RemovedConst = typename TypeTraits::RemoveConst<Type>::type;
 template <class Type> using RemovedVolatile = typename TypeTraits::RemoveVolatile<Type>::type;
 template <class Type> using RemovedQuals = typename TypeTraits::RemoveQuals<Type>::type;
@@ -0,0 +1,1385 @@
+#include "Benchmarks.hpp"
+
+#include "Core\Logger.hpp"
+#include "Core\Time.hpp"
+#include "Memory\Memory.hpp"
+#include "Containers\Vector.hpp"
+#include "Containers\SmallVector.hpp"
+#include "Containers\HandlePool.hpp"
+#include "Containers\BitFreelist.hpp"
+#include "Containers\ConcurrentHashmap.hpp"
+#include "Containers\String.hpp"
+#include "Entities\EntityDefines.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "TileRegistry.hpp"
+#include "Liquid.hpp"
+#include "Lighting.hpp"
+#include "Snapshots.hpp"
+#include "History.hpp"
+#include "Pathfinding.hpp"
+#include "Collision.hpp"
+#include "Entities.hpp"
+#include "SpatialGrid.hpp"
+#include "RandomTicks.hpp"
+#include "FallingTiles.hpp"
+#include "TileEntities.hpp"
+#include "Minimap.hpp"
+#include "Exploration.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+void Benchmarks::Run()
+{
+	Logger::Info("Running benchmarks...");
+
+	LiquidFlood();
+	LightingUpdates();
+	SnapshotHistory();
+	HistoryScrub();
+	PathQueries();
+	CollisionBodies();
+	Raycasts();
+	EntityIteration();
+	SpatialQueries();
+	GrassGrowth();
+	CaveIn();
+	TileEntityLookups();
+	MinimapUpdates();
+	ExplorationMap();
+	Sorting();
+	SmallLists();
+	PoolHandles();
+	FreeSlots();
+	ConcurrentLookups();
+	StringParsing();
+	StringSearch();
+	NumberFormatting();
+	FormatLines();
+}
+
+void Benchmarks::LiquidFlood()
+{
+	static constexpr U32 MAX_TICKS = 4000;
+	static constexpr I32 BORDER = 8;
+
+	World::Resize(WORLD_SIZE_TEST);
+	World::GenerateWorld();
+	Liquid::Reset();
+
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+
+	//Hollow out a basin and fill its top half
+	for (I32 y = BORDER; y < height - BORDER; ++y)
+	{
+		for (I32 x = BORDER; x < width - BORDER; ++x)
+		{
+			U32 index = World::TileIndex(x, y);
+			World::tiles[index].block = U8_MAX;
+			World::tiles[index].liquidAmt = 0;
+
+			if (y >= height / 2) { Liquid::AddLiquid(index, LIQUID_MAX); }
+		}
+	}
+
+	U64 cellCount = 0;
+	U32 ticks = 0;
+
+	Timer timer;
+	timer.Start();
+
+	while (ticks < MAX_TICKS && Liquid::ActiveChunkCount())
+	{
+		Liquid::Update();
+		cellCount += Liquid::CellsUpdated();
+		++ticks;
+	}
+
+	F64 seconds = timer.CurrentTime();
+
+	Logger::Info("Liquid flood: {} ticks, {} cell updates in {.3}s, {} cells/s", ticks, cellCount, seconds, (U64)(cellCount / seconds));
+}
+
+void Benchmarks::LightingUpdates()
+{
+	static constexpr U32 EDIT_COUNT = 1000;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Lighting::Reset();
+
+	const I32 width = World::TILE_COUNT_X;
+
+	Timer timer;
+	timer.Start();
+
+	Lighting::Relight();
+
+	F64 relightSeconds = timer.CurrentTime();
+
+	//Dig out and refill a surface block, which moves both the sky column and the surface flood
+	F64 editSeconds = 0.0;
+	U32 editCount = 0;
+
+	for (U32 i = 0; i < EDIT_COUNT; ++i)
+	{
+		I32 x = (I32)((i * 7919) % width);
+		I32 y = Lighting::skyHeights[x] - 1;
+		if (y < 0) { continue; }
+
+		U32 index = World::TileIndex(x, y);
+		Tile previous = World::tiles[index];
+
+		timer.Restart();
+
+		World::SetTile(index, TILE_LAYER_BLOCK, U8_MAX);
+		World::SetTile(index, TILE_LAYER_WALL, U8_MAX);
+		World::SetTile(index, TILE_LAYER_WALL, previous.wall);
+		World::SetTile(index, TILE_LAYER_BLOCK, previous.block);
+
+		editSeconds += timer.CurrentTime();
+		editCount += 4;
+	}
+
+	//Columns with no surface are skipped, so only the edits that ran are averaged
+	if (!editCount) { editCount = 1; }
+
+	Logger::Info("Lighting: full relight of {}x{} tiles in {.3}ms, {.3}us per tile edit", width, (I32)World::TILE_COUNT_Y, relightSeconds * 1000.0, editSeconds * 1000000.0 / editCount);
+}
+
+void Benchmarks::SnapshotHistory()
+{
+	static constexpr U32 EDITS_PER_SNAPSHOT = 256;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Lighting::Reset();
+	Lighting::Relight();
+
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+
+	Timer timer;
+	timer.Start();
+
+	Snapshots::Capture();
+
+	F64 baseSeconds = timer.CurrentTime();
+	U64 baseMemory = Snapshots::SnapshotMemory(0);
+
+	//Dig scattered holes between snapshots, the way a player or a cave-in would
+	U64 editMemory = 0;
+
+	for (U32 s = 1; s < SNAPSHOT_COUNT; ++s)
+	{
+		for (U32 i = 0; i < EDITS_PER_SNAPSHOT; ++i)
+		{
+			U32 seed = s * EDITS_PER_SNAPSHOT + i;
+			I32 x = (I32)((seed * 7919) % width);
+			I32 y = (I32)((seed * 104729) % (height / 2));
+
+			World::SetTile(World::TileIndex(x, y), TILE_LAYER_BLOCK, U8_MAX);
+		}
+
+		World::tick += SNAPSHOT_INTERVAL;
+		Snapshots::Capture();
+		editMemory += Snapshots::SnapshotMemory(0);
+	}
+
+	Snapshots::Restore(SNAPSHOT_COUNT - 1);
+
+	Logger::Info("Snapshots: base {}kb in {.3}ms, {}kb per snapshot of {} edits, {}kb total",
+		baseMemory / 1024, baseSeconds * 1000.0, editMemory / (SNAPSHOT_COUNT - 1) / 1024, EDITS_PER_SNAPSHOT, Snapshots::TotalMemory() / 1024);
+	Logger::Info("Snapshots: restored {} chunks across {} snapshots in {.3}ms",
+		Snapshots::LastRestoreChunkCount(), SNAPSHOT_COUNT - 1, Snapshots::LastRestoreTime() * 1000.0);
+}
+
+void Benchmarks::HistoryScrub()
+{
+	static constexpr U32 TICK_COUNT = 1024;
+	static constexpr U32 POUR_COLUMNS = 64;
+	static constexpr U32 SEEK_COUNT = 32;
+	static constexpr U32 STEP_COUNT = 256;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Lighting::Reset();
+	Lighting::Relight();
+	Snapshots::Capture();
+
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+
+	//Pour liquid from the top of the sky every tick so the log fills with real simulation edits
+	for (U32 t = 0; t < TICK_COUNT; ++t)
+	{
+		for (U32 i = 0; i < POUR_COLUMNS; ++i)
+		{
+			Liquid::AddLiquid(World::TileIndex((I32)((i * 87 + 13) % width), height - 2), LIQUID_MAX / 4);
+		}
+
+		World::Tick();
+	}
+
+	U64 edits = History::EditCount();
+	U64 memory = History::MemoryUsed();
+
+	F64 seekSeconds = 0.0;
+
+	for (U32 i = 0; i < SEEK_COUNT; ++i)
+	{
+		History::Seek(History::FirstTick() + (i * 7919) % (TICK_COUNT + 1));
+		seekSeconds += History::LastSeekTime();
+	}
+
+	History::Seek(History::LastTick());
+
+	Timer timer;
+	timer.Start();
+
+	for (U32 i = 0; i < STEP_COUNT; ++i) { History::StepBackward(); }
+	for (U32 i = 0; i < STEP_COUNT; ++i) { History::StepForward(); }
+
+	F64 stepSeconds = timer.CurrentTime();
+
+	Logger::Info("History: {} edits over {} ticks in {}kb, {}kb per million edits (raw {}kb)",
+		edits, TICK_COUNT, memory / 1024, (U64)(memory * 1000000.0 / edits / 1024), (U64)(sizeof(TileDelta) * 1000000 / 1024));
+	Logger::Info("History: {.3}ms average seek, {} ticks/s playback", seekSeconds * 1000.0 / SEEK_COUNT, (U64)(STEP_COUNT * 2 / stepSeconds));
+}
+
+void Benchmarks::PathQueries()
+{
+	static constexpr U32 QUERY_COUNT = 1024;
+	static constexpr I32 TUNNEL_DEPTH = 200;
+	static constexpr I32 SHAFT_SPACING = 256;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Lighting::Reset();
+	Lighting::Relight();
+
+	const I32 width = World::TILE_COUNT_X;
+
+	//A tunnel under the whole world with shafts up to the surface, so underground paths have to detour
+	const I32 tunnelY = Lighting::skyHeights[0] - TUNNEL_DEPTH;
+
+	for (I32 x = 0; x < width; ++x)
+	{
+		World::tiles[World::TileIndex(x, tunnelY)].block = U8_MAX;
+		World::tiles[World::TileIndex(x, tunnelY + 1)].block = U8_MAX;
+
+		if (x % SHAFT_SPACING == SHAFT_SPACING / 2)
+		{
+			for (I32 y = tunnelY; y < Lighting::skyHeights[x]; ++y) { World::tiles[World::TileIndex(x, y)].block = U8_MAX; }
+		}
+	}
+
+	Timer timer;
+	timer.Start();
+
+	Pathfinding::Build();
+
+	F64 buildSeconds = timer.CurrentTime();
+
+	//Half the queries walk the surface, half go from the surface down into the tunnel far away
+	U32 tickets[QUERY_COUNT];
+
+	for (U32 i = 0; i < QUERY_COUNT; ++i)
+	{
+		I32 startX = (I32)((i * 7919) % width);
+		I32 goalX = (startX + width / 4 + (I32)((i * 104729) % (width / 2))) % width;
+
+		U32 start = World::TileIndex(startX, Lighting::skyHeights[startX]);
+		U32 goal = i & 1 ? World::TileIndex(goalX, tunnelY) : World::TileIndex(goalX, Lighting::skyHeights[goalX]);
+
+		tickets[i] = Pathfinding::QueuePath(start, goal);
+	}
+
+	timer.Restart();
+
+	Pathfinding::Update();
+
+	F64 querySeconds = timer.CurrentTime();
+
+	U32 found = 0;
+	U64 totalLength = 0;
+
+	for (U32 ticket : tickets)
+	{
+		const U32* path;
+		U32 length;
+
+		if (Pathfinding::GetPath(ticket, path, length) == PATH_STATUS_FOUND)
+		{
+			++found;
+			totalLength += length;
+		}
+	}
+
+	Logger::Info("Pathfinding: graph built in {.3}ms, {}/{} paths found averaging {} tiles, {} queries/s",
+		buildSeconds * 1000.0, found, QUERY_COUNT, found ? totalLength / found : 0, (U64)(QUERY_COUNT / querySeconds));
+}
+
+void Benchmarks::CollisionBodies()
+{
+	static constexpr U32 BODY_COUNT = 16384;
+	static constexpr U32 TICKS = 300;
+	static constexpr F32 GRAVITY = -200.0f;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Collision::Build();
+
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+
+	//Bodies of a few sizes dropped from near the top of the world, drifting sideways into hills
+	CollisionBody* bodies;
+	Memory::AllocateArray(&bodies, BODY_COUNT);
+
+	for (U32 i = 0; i < BODY_COUNT; ++i)
+	{
+		F32 tileX = (F32)((i * 7919) % (width - 4) + 2);
+		F32 tileY = (F32)(height - 4 - (I32)(i % 256));
+
+		CollisionBody& body = bodies[i];
+		body.position = { (tileX - World::TILE_OFFSET_X) * TILE_WIDTH, (tileY - World::TILE_OFFSET_Y) * TILE_HEIGHT };
+		body.halfExtents = { TILE_WIDTH * (0.4f + (i % 3) * 0.5f), TILE_HEIGHT * (0.9f + (i % 2) * 0.5f) };
+		body.velocity = { (F32)((I32)(i % 61) - 30), 0.0f };
+		body.contacts = COLLISION_CONTACT_NONE;
+	}
+
+	Timer timer;
+	timer.Start();
+
+	for (U32 tick = 0; tick < TICKS; ++tick)
+	{
+		for (U32 i = 0; i < BODY_COUNT; ++i) { bodies[i].velocity.y += GRAVITY * (F32)TICK_TIME; }
+
+		Collision::MoveBodies(bodies, BODY_COUNT, (F32)TICK_TIME);
+	}
+
+	F64 seconds = timer.CurrentTime();
+
+	U32 grounded = 0;
+	U32 inside = 0;
+
+	for (U32 i = 0; i < BODY_COUNT; ++i)
+	{
+		const CollisionBody& body = bodies[i];
+		if (body.contacts & COLLISION_CONTACT_FLOOR) { ++grounded; }
+		if (Collision::Overlaps(body.position - body.halfExtents, body.position + body.halfExtents)) { ++inside; }
+	}
+
+	Memory::Free(&bodies);
+
+	Logger::Info("Collision: {} bodies for {} ticks in {.3}ms, {} moves/s, {} grounded, {} overlapping tiles",
+		BODY_COUNT, TICKS, seconds * 1000.0, (U64)(BODY_COUNT * TICKS / seconds), grounded, inside);
+}
+
+void Benchmarks::Raycasts()
+{
+	static constexpr U32 RAY_COUNT = 65536;
+	static constexpr U32 CIRCLE_COUNT = 4096;
+	static constexpr F32 RAY_LENGTH = 1500.0f;
+	static constexpr F32 CIRCLE_RADIUS = 30.0f;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Collision::Build();
+
+	const I32 width = World::TILE_COUNT_X;
+
+	//Rays fan out from points above the surface, most cross open sky before reaching the ground
+	Ray* rays;
+	RaycastHit* hits;
+	Memory::AllocateArray(&rays, RAY_COUNT);
+	Memory::AllocateArray(&hits, RAY_COUNT);
+
+	for (U32 i = 0; i < RAY_COUNT; ++i)
+	{
+		F32 angle = (F32)i * 0.618034f * (F32)TWO_PI;
+		F32 tileX = (F32)((i * 7919) % width);
+
+		rays[i].origin = { (tileX - World::TILE_OFFSET_X) * TILE_WIDTH, 200.0f + (F32)(i % 64) * 10.0f };
+		rays[i].direction = { Math::Cos(angle), Math::Sin(angle) };
+		rays[i].maxDistance = RAY_LENGTH;
+	}
+
+	Timer timer;
+	timer.Start();
+
+	World::RaycastBatch(rays, hits, RAY_COUNT);
+
+	F64 raySeconds = timer.CurrentTime();
+
+	U32 hitCount = 0;
+	for (U32 i = 0; i < RAY_COUNT; ++i) { if (hits[i].index != U32_MAX) { ++hitCount; } }
+
+	timer.Restart();
+
+	U64 solidCount = 0;
+
+	for (U32 i = 0; i < CIRCLE_COUNT; ++i)
+	{
+		World::ForEachTileInCircle(rays[i].origin + rays[i].direction * (RAY_LENGTH * 0.5f), CIRCLE_RADIUS, [&solidCount](U32, Tile& tile) {
+			if (tile.block != U8_MAX) { ++solidCount; }
+		});
+	}
+
+	F64 circleSeconds = timer.CurrentTime();
+
+	Memory::Free(&rays);
+	Memory::Free(&hits);
+
+	Logger::Info("Raycasts: {} rays in {.3}ms ({} rays/s), {} hit, {} circle queries in {.3}ms covering {} solid tiles",
+		RAY_COUNT, raySeconds * 1000.0, (U64)(RAY_COUNT / raySeconds), hitCount, CIRCLE_COUNT, circleSeconds * 1000.0, solidCount);
+}
+
+void Benchmarks::EntityIteration()
+{
+	static constexpr U32 ENTITY_COUNT = 100000;
+	static constexpr U32 ITERATIONS = 100;
+
+	//Every tenth entity also has a Collision body, so the query spans two archetypes
+	Vector<Entity> entities(ENTITY_COUNT);
+
+	Timer timer;
+	timer.Start();
+
+	for (U32 i = 0; i < ENTITY_COUNT; ++i)
+	{
+		Transform transform{};
+		transform.position = { (F32)(i % 1000), (F32)(i / 1000), 0.0f };
+		Velocity velocity{ { 1.0f, (F32)(i % 7) - 3.0f, 0.0f } };
+
+		if (i % 10 == 0) { entities.Push(Entities::Create(transform, velocity, CollisionBody{})); }
+		else { entities.Push(Entities::Create(transform, velocity)); }
+	}
+
+	F64 createSeconds = timer.CurrentTime();
+
+	EntityQuery<Transform, Velocity> query;
+	const F32 deltaTime = (F32)TICK_TIME;
+
+	timer.Restart();
+
+	for (U32 i = 0; i < ITERATIONS; ++i)
+	{
+		query.ForEach([deltaTime](Entity, Transform& transform, Velocity& velocity) { transform.position += velocity.linear * deltaTime; });
+	}
+
+	F64 serialSeconds = timer.CurrentTime();
+
+	timer.Restart();
+
+	for (U32 i = 0; i < ITERATIONS; ++i)
+	{
+		query.ParallelForEach([deltaTime](Entity, Transform& transform, Velocity& velocity) { transform.position += velocity.linear * deltaTime; });
+	}
+
+	F64 parallelSeconds = timer.CurrentTime();
+
+	U32 matched = query.Count();
+
+	timer.Restart();
+
+	for (Entity entity : entities) { Entities::Destroy(entity); }
+
+	F64 destroySeconds = timer.CurrentTime();
+
+	query.Destroy();
+	entities.Destroy();
+
+	Logger::Info("Entities: {} created in {.3}ms, {} iterated in {.3}ms serial and {.3}ms parallel per pass, destroyed in {.3}ms",
+		ENTITY_COUNT, createSeconds * 1000.0, matched, serialSeconds * 1000.0 / ITERATIONS, parallelSeconds * 1000.0 / ITERATIONS, destroySeconds * 1000.0);
+}
+
+void Benchmarks::SpatialQueries()
+{
+	static constexpr U32 ENTITY_COUNT = 50000;
+	static constexpr U32 TICKS = 60;
+	static constexpr U32 QUERY_COUNT = 10000;
+	static constexpr F32 AREA = 3000.0f;
+	static constexpr F32 QUERY_RADIUS = 40.0f;
+
+	//Entities wander around a square of the world, some of them cross a cell border every tick
+	Entity* entities;
+	Vector2* positions;
+	Vector2* velocities;
+	Memory::AllocateArray(&entities, ENTITY_COUNT);
+	Memory::AllocateArray(&positions, ENTITY_COUNT);
+	Memory::AllocateArray(&velocities, ENTITY_COUNT);
+
+	for (U32 i = 0; i < ENTITY_COUNT; ++i)
+	{
+		entities[i] = { i, 0 };
+		positions[i] = { (F32)((i * 7919) % 3000) - AREA * 0.5f, (F32)((i * 104729) % 3000) - AREA * 0.5f };
+		velocities[i] = { (F32)((I32)(i % 41) - 20), (F32)((I32)(i % 37) - 18) };
+	}
+
+	Timer timer;
+	timer.Start();
+
+	SpatialGrid::Rebuild(entities, positions, ENTITY_COUNT);
+
+	F64 rebuildSeconds = timer.CurrentTime();
+
+	timer.Restart();
+
+	for (U32 tick = 0; tick < TICKS; ++tick)
+	{
+		for (U32 i = 0; i < ENTITY_COUNT; ++i) { positions[i] += velocities[i] * (F32)TICK_TIME; }
+
+		SpatialGrid::MoveAll(entities, positions, ENTITY_COUNT);
+	}
+
+	F64 moveSeconds = timer.CurrentTime();
+
+	Vector<Entity> results;
+	U64 found = 0;
+
+	timer.Restart();
+
+	for (U32 i = 0; i < QUERY_COUNT; ++i)
+	{
+		results.Clear();
+		SpatialGrid::QueryRadius(positions[(i * 31) % ENTITY_COUNT], QUERY_RADIUS, results);
+		found += results.Size();
+	}
+
+	F64 querySeconds = timer.CurrentTime();
+
+	SpatialGrid::Clear();
+	results.Destroy();
+	Memory::Free(&entities);
+	Memory::Free(&positions);
+	Memory::Free(&velocities);
+
+	Logger::Info("SpatialGrid: rebuilt {} entities in {.3}ms, {.3}ms per tick moving them, {} radius queries in {.3}ms averaging {} neighbours",
+		ENTITY_COUNT, rebuildSeconds * 1000.0, moveSeconds * 1000.0 / TICKS, QUERY_COUNT, querySeconds * 1000.0, found / QUERY_COUNT);
+}
+
+void Benchmarks::GrassGrowth()
+{
+	static constexpr U32 TICKS = 600;
+	static constexpr I32 SEED_SPACING = 64;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Lighting::Reset();
+	Lighting::Relight();
+
+	const I32 width = World::TILE_COUNT_X;
+
+	//Bare the surface except for a tuft every SEED_SPACING columns, then let the whole world random tick
+	for (I32 x = 0; x < width; ++x)
+	{
+		if (x % SEED_SPACING) { World::tiles[World::TileIndex(x, Lighting::skyHeights[x] - 1)].decoration = U8_MAX; }
+	}
+
+	U64 edits = RandomTicks::EditCount();
+
+	Timer timer;
+	timer.Start();
+
+	for (U32 i = 0; i < TICKS; ++i)
+	{
+		++World::tick;
+		RandomTicks::TickRegion(0, 0, World::CHUNK_COUNT_X - 1, World::CHUNK_COUNT_Y - 1);
+	}
+
+	F64 seconds = timer.CurrentTime();
+
+	U32 grassCount = 0;
+
+	for (I32 x = 0; x < width; ++x)
+	{
+		if (World::tiles[World::TileIndex(x, Lighting::skyHeights[x] - 1)].decoration != U8_MAX) { ++grassCount; }
+	}
+
+	U32 chunkCount = (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y;
+
+	Logger::Info("RandomTicks: {} chunks for {} ticks in {.3}ms per tick, {} edits, grass on {}/{} surface columns",
+		chunkCount, TICKS, seconds * 1000.0 / TICKS, RandomTicks::EditCount() - edits, grassCount, width);
+}
+
+void Benchmarks::CaveIn()
+{
+	static constexpr I32 CAVE_WIDTH = 1024;
+	static constexpr I32 CAVE_HEIGHT = 96;
+	static constexpr I32 CAVE_DEPTH = 24; //Tiles of ground left over the cave
+	static constexpr U32 MAX_TICKS = 1000;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Lighting::Reset();
+	Lighting::Relight();
+
+	const I32 width = World::TILE_COUNT_X;
+	const I32 left = (width - CAVE_WIDTH) / 2;
+
+	//Dig out a cave under the surface while dirt still holds, then let the whole roof come down at once
+	for (I32 x = left; x < left + CAVE_WIDTH; ++x)
+	{
+		I32 top = Lighting::skyHeights[x] - CAVE_DEPTH;
+
+		for (I32 y = top - CAVE_HEIGHT; y < top; ++y) { World::tiles[World::TileIndex(x, y)].block = U8_MAX; }
+	}
+
+	Lighting::Relight();
+	Collision::Build();
+
+	FallingTiles::falls[0] = true;
+	FallingTiles::Build();
+
+	for (I32 x = left; x < left + CAVE_WIDTH; ++x) { FallingTiles::Queue(x, Lighting::skyHeights[x] - CAVE_DEPTH - CAVE_HEIGHT); }
+
+	Memory::Zero(World::dirtyChunks, sizeof(U64) * (TOTAL_CHUNK_COUNT / 64 + 1));
+	U64 moved = FallingTiles::TilesMoved();
+	U32 ticks = 0;
+
+	Timer timer;
+	timer.Start();
+
+	while (ticks < MAX_TICKS && FallingTiles::ActiveColumnCount())
+	{
+		FallingTiles::Update();
+		++ticks;
+	}
+
+	F64 seconds = timer.CurrentTime();
+
+	FallingTiles::falls[0] = BLOCKS.falls[0];
+
+	U32 dirtyCount = 0;
+	for (U32 i = 0; i < TOTAL_CHUNK_COUNT / 64 + 1; ++i) { dirtyCount += (U32)BitCount(World::dirtyChunks[i]); }
+
+	Logger::Info("Cave-in: {} columns settled in {} ticks, {} tile writes in {.3}ms per tick, {} dirty chunks",
+		CAVE_WIDTH, ticks, FallingTiles::TilesMoved() - moved, seconds * 1000.0 / ticks, dirtyCount);
+}
+
+void Benchmarks::TileEntityLookups()
+{
+	static constexpr U32 TILE_ENTITY_COUNT = 100000;
+	static constexpr U32 LOOKUP_COUNT = 1000000;
+
+	World::Resize(WORLD_SIZE_LARGE);
+
+	const U32 width = World::TILE_COUNT_X;
+	const U32 height = World::TILE_COUNT_Y;
+
+	Timer timer;
+	timer.Start();
+
+	for (U32 i = 0; i < TILE_ENTITY_COUNT; ++i) { TileEntities::Create((i * 7919) % width, (i * 104729) % height, (TileEntityType)(i % TILE_ENTITY_TYPE_COUNT)); }
+
+	F64 createSeconds = timer.CurrentTime();
+
+	U32 found = 0;
+	timer.Restart();
+
+	for (U32 i = 0; i < LOOKUP_COUNT; ++i) { found += TileEntities::Get((i * 7919) % width, (i * 104729) % height) != nullptr; }
+
+	F64 lookupSeconds = timer.CurrentTime();
+
+	U32 enumerated = 0;
+	timer.Restart();
+
+	for (U32 chunkIndex = 0; chunkIndex < (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y; ++chunkIndex)
+	{
+		TileEntities::ForEachInChunk(chunkIndex, [&](TileEntity&) { ++enumerated; });
+	}
+
+	F64 enumerateSeconds = timer.CurrentTime();
+
+	timer.Restart();
+
+	for (U32 i = 0; i < TILE_ENTITY_COUNT; i += 2) { TileEntities::Destroy((i * 7919) % width, (i * 104729) % height); }
+
+	F64 destroySeconds = timer.CurrentTime();
+	U32 remaining = TileEntities::Count();
+
+	TileEntities::Clear();
+
+	Logger::Info("TileEntities: created {} in {.3}ms, {} lookups in {.3}ms ({} hits), enumerated {} by chunk in {.3}ms, destroyed half in {.3}ms leaving {}",
+		TILE_ENTITY_COUNT, createSeconds * 1000.0, LOOKUP_COUNT, lookupSeconds * 1000.0, found, enumerated, enumerateSeconds * 1000.0, destroySeconds * 1000.0, remaining);
+}
+
+void Benchmarks::MinimapUpdates()
+{
+	static constexpr U32 EDIT_COUNT = 10000;
+
+	World::Resize(WORLD_SIZE_LARGE);
+	World::GenerateWorld();
+	Lighting::Reset();
+	Lighting::Relight();
+
+	Timer timer;
+	timer.Start();
+
+	Minimap::Build();
+
+	F64 buildSeconds = timer.CurrentTime();
+
+	const U32 width = World::TILE_COUNT_X;
+	const U32 height = World::TILE_COUNT_Y;
+
+	//Scattered edits so every one dirties its own chunk
+	for (U32 i = 0; i < EDIT_COUNT; ++i)
+	{
+		U32 index = World::TileIndex((i * 7919) % width, (i * 104729) % height);
+		World::SetTile(index, TILE_LAYER_BLOCK, World::tiles[index].block == U8_MAX ? 0 : U8_MAX);
+	}
+
+	timer.Restart();
+
+	Minimap::Update();
+
+	F64 updateSeconds = timer.CurrentTime();
+
+	Logger::Info("Minimap: built {} levels over {}x{} tiles in {.3}ms, patched {} edits in {.3}ms, {.3}us per edit",
+		Minimap::LevelCount(), width, height, buildSeconds * 1000.0, EDIT_COUNT, updateSeconds * 1000.0, updateSeconds * 1000000.0 / EDIT_COUNT);
+}
+
+void Benchmarks::ExplorationMap()
+{
+	static constexpr U32 REVEAL_COUNT = 20000;
+	static constexpr U32 QUERY_COUNT = 10000000;
+	static constexpr I32 STEP = 3; //Tiles walked between reveals
+
+	World::Resize(WORLD_SIZE_LARGE);
+
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+
+	//A wandering walk across the world, most reveals overlap the last one like a moving view would
+	Timer timer;
+	timer.Start();
+
+	for (U32 i = 0; i < REVEAL_COUNT; ++i)
+	{
+		I32 x = (I32)((i * STEP) % width);
+		I32 y = height / 2 + (I32)(Math::Sin(i * 0.01f) * height * 0.4f);
+
+		Exploration::Reveal(x, y, EXPLORE_RADIUS);
+	}
+
+	F64 revealSeconds = timer.CurrentTime();
+
+	U32 hits = 0;
+	timer.Restart();
+
+	for (U32 i = 0; i < QUERY_COUNT; ++i) { hits += Exploration::Explored((i * 7919) % width, (i * 104729) % height); }
+
+	F64 querySeconds = timer.CurrentTime();
+
+	Vector<U8> data;
+	timer.Restart();
+
+	Exploration::Serialize(data);
+
+	F64 serializeSeconds = timer.CurrentTime();
+
+	U64 explored = Exploration::ExploredCount();
+	timer.Restart();
+
+	bool loaded = Exploration::Deserialize(data.Data(), data.Size());
+
+	F64 deserializeSeconds = timer.CurrentTime();
+
+	if (!loaded || Exploration::ExploredCount() != explored) { Logger::Error("Exploration: round trip lost tiles"); }
+
+	Logger::Info("Exploration: {} reveals in {.3}ms, {} queries in {.3}ms ({} hits), {} explored tiles serialized to {} bytes in {.3}ms, loaded in {.3}ms",
+		REVEAL_COUNT, revealSeconds * 1000.0, QUERY_COUNT, querySeconds * 1000.0, hits, explored, data.Size(), serializeSeconds * 1000.0, deserializeSeconds * 1000.0);
+}
+
+template<typename T>
+static bool Sorted(const Vector<T>& values)
+{
+	for (U64 i = 1; i < values.Size(); ++i) { if (values[i] < values[i - 1]) { return false; } }
+
+	return true;
+}
+
+void Benchmarks::Sorting()
+{
+	static constexpr U64 SIZES[]{ 1000, 100000, 1000000, 10000000 };
+
+	auto less = [](const U32& a, const U32& b) { return a < b; };
+
+	for (U64 count : SIZES)
+	{
+		//xorshift keys, regenerated before each sort so every one starts from the same order
+		Vector<U32> values(count);
+		values.Resize(count);
+
+		auto fill = [&values, count]() {
+			U32 state = 2463534242u;
+			for (U64 i = 0; i < count; ++i)
+			{
+				state ^= state << 13;
+				state ^= state >> 17;
+				state ^= state << 5;
+				values[i] = state;
+			}
+		};
+
+		Timer timer;
+		F64 seconds[5];
+
+		fill();
+		timer.Start();
+		std::sort(values.Data(), values.Data() + count);
+		seconds[0] = timer.CurrentTime();
+
+		fill();
+		timer.Restart();
+		values.Sort();
+		seconds[1] = timer.CurrentTime();
+		if (!Sorted(values)) { Logger::Error("Sorting: Sort left {} values out of order", count); }
+
+		fill();
+		timer.Restart();
+		values.StableSort(less);
+		seconds[2] = timer.CurrentTime();
+		if (!Sorted(values)) { Logger::Error("Sorting: StableSort left {} values out of order", count); }
+
+		fill();
+		timer.Restart();
+		values.RadixSort();
+		seconds[3] = timer.CurrentTime();
+		if (!Sorted(values)) { Logger::Error("Sorting: RadixSort left {} values out of order", count); }
+
+		fill();
+		timer.Restart();
+		values.ParallelSort(less);
+		seconds[4] = timer.CurrentTime();
+		if (!Sorted(values)) { Logger::Error("Sorting: ParallelSort left {} values out of order", count); }
+
+		Logger::Info("Sorting: {} values, std::sort {.3}ms, Sort {.3}ms, StableSort {.3}ms, RadixSort {.3}ms, ParallelSort {.3}ms",
+			count, seconds[0] * 1000.0, seconds[1] * 1000.0, seconds[2] * 1000.0, seconds[3] * 1000.0, seconds[4] * 1000.0);
+	}
+}
+
+static constexpr U32 SMALL_LIST_COUNT = 100000;
+static constexpr U32 SMALL_LIST_REBUILDS = 10;
+
+//Rebuilds child lists like a UI tree's, every time a list's data moves counts as an allocation
+template<typename List>
+static U64 RebuildLists(U64& allocations)
+{
+	U64 sum = 0;
+
+	for (U32 rebuild = 0; rebuild < SMALL_LIST_REBUILDS; ++rebuild)
+	{
+		for (U32 i = 0; i < SMALL_LIST_COUNT; ++i)
+		{
+			//Most lists hold a few values and about one in eight holds dozens
+			U32 hash = i * 2654435761u;
+			U32 count = (hash >> 29) ? (hash >> 20) % 5 : 8 + (hash >> 20) % 24;
+
+			List children;
+			const U32* data = children.Data();
+
+			for (U32 child = 0; child < count; ++child)
+			{
+				children.Push(i + child);
+				if (children.Data() != data) { ++allocations; data = children.Data(); }
+			}
+
+			for (U32 child : children) { sum += child; }
+		}
+	}
+
+	return sum;
+}
+
+void Benchmarks::SmallLists()
+{
+	U64 vectorAllocations = 0;
+	U64 smallAllocations = 0;
+
+	Timer timer;
+	timer.Start();
+
+	U64 vectorSum = RebuildLists<Vector<U32>>(vectorAllocations);
+
+	F64 vectorSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	U64 smallSum = RebuildLists<SmallVector<U32, 4>>(smallAllocations);
+
+	F64 smallSeconds = timer.CurrentTime();
+
+	if (vectorSum != smallSum) { Logger::Error("SmallLists: SmallVector values don't match Vector's"); }
+
+	Logger::Info("SmallLists: {} lists rebuilt {} times, Vector {} allocations in {.3}ms, SmallVector {} allocations in {.3}ms",
+		SMALL_LIST_COUNT, SMALL_LIST_REBUILDS, vectorAllocations, vectorSeconds * 1000.0, smallAllocations, smallSeconds * 1000.0);
+}
+
+void Benchmarks::PoolHandles()
+{
+	static constexpr U32 OBJECT_COUNT = 100000;
+	static constexpr U32 LOOKUP_COUNT = 10000000;
+
+	HandlePool<Vector3> pool;
+	pool.Create(OBJECT_COUNT / 4);
+
+	Vector<U64> handles(OBJECT_COUNT);
+
+	Timer timer;
+	timer.Start();
+
+	for (U32 i = 0; i < OBJECT_COUNT; ++i)
+	{
+		U64 handle;
+		*pool.Request(handle) = { (F32)i, 0.0f, 0.0f };
+		handles.Push(handle);
+	}
+
+	//Every third is released and requested again, the old handles must all go stale
+	for (U32 i = 0; i < OBJECT_COUNT; i += 3) { pool.Release(handles[i]); }
+
+	U32 reused = 0;
+	for (U32 i = 0; i < OBJECT_COUNT; i += 3)
+	{
+		U64 handle;
+		*pool.Request(handle) = { (F32)i, 1.0f, 0.0f };
+		reused += (U32)handle == (U32)handles[i];
+	}
+
+	F64 churnSeconds = timer.CurrentTime();
+
+	U32 stale = 0;
+	for (U32 i = 0; i < OBJECT_COUNT; i += 3) { stale += pool.Obtain(handles[i]) == nullptr; }
+
+	if (stale != (OBJECT_COUNT + 2) / 3) { Logger::Error("PoolHandles: {} released handles still resolve", (OBJECT_COUNT + 2) / 3 - stale); }
+
+	F32 sum = 0.0f;
+	timer.Restart();
+
+	for (U32 i = 0; i < LOOKUP_COUNT; ++i)
+	{
+		Vector3* object = pool.Obtain(handles[(i * 7919) % OBJECT_COUNT]);
+		if (object) { sum += object->x; }
+	}
+
+	F64 lookupSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	pool.ForEach([&sum](U64, Vector3& object) { sum += object.y; });
+
+	F64 iterateSeconds = timer.CurrentTime();
+
+	pool.Destroy();
+
+	Logger::Info("PoolHandles: {} requested and a third churned in {.3}ms ({} slots reused), {} lookups in {.3}ms, {} live iterated in {.3}ms ({})",
+		OBJECT_COUNT, churnSeconds * 1000.0, reused, LOOKUP_COUNT, lookupSeconds * 1000.0, OBJECT_COUNT, iterateSeconds * 1000.0, sum);
+}
+
+void Benchmarks::FreeSlots()
+{
+	static constexpr U32 SLOT_COUNT = 1 << 20;
+	static constexpr U32 RUN_LENGTH = 16;
+
+	BitFreelist slots(SLOT_COUNT / 2);
+
+	Timer timer;
+	timer.Start();
+
+	//Fills past the starting capacity, then frees every other block of 64 so runs have to be searched for
+	for (U32 i = 0; i < SLOT_COUNT; ++i)
+	{
+		if (slots.Full()) { slots.Resize(slots.Capacity() * 2); }
+		slots.GetFree();
+	}
+
+	F64 fillSeconds = timer.CurrentTime();
+
+	for (U32 i = 0; i < SLOT_COUNT; i += 128) { slots.Release(i, 64); }
+
+	U32 singles = 0;
+	timer.Restart();
+
+	for (U32 i = 0; i < SLOT_COUNT / 4; ++i) { singles += slots.GetFree() != U32_MAX; }
+
+	F64 singleSeconds = timer.CurrentTime();
+
+	while (!slots.Full()) { slots.GetFree(); }
+	for (U32 i = 0; i < SLOT_COUNT; i += 128) { slots.Release(i, 64); }
+
+	U32 runs = 0;
+	U32 misplaced = 0;
+	timer.Restart();
+
+	for (U32 i = 0; i < SLOT_COUNT / 128 * (64 / RUN_LENGTH); ++i)
+	{
+		U32 first = slots.GetFree(RUN_LENGTH);
+		if (first == U32_MAX) { break; }
+
+		++runs;
+		misplaced += (first & 127) + RUN_LENGTH > 64;
+	}
+
+	F64 runSeconds = timer.CurrentTime();
+
+	if (misplaced || !slots.Full()) { Logger::Error("FreeSlots: {} runs crossed a used block", misplaced); }
+
+	Logger::Info("FreeSlots: {} slots filled in {.3}ms, {} single slots in {.3}ms, {} runs of {} in {.3}ms",
+		SLOT_COUNT, fillSeconds * 1000.0, singles, singleSeconds * 1000.0, runs, RUN_LENGTH, runSeconds * 1000.0);
+}
+
+void Benchmarks::ConcurrentLookups()
+{
+	static constexpr U64 KEY_COUNT = 65536;
+	static constexpr U32 JOB_COUNT = 64;
+	static constexpr U32 OPERATION_COUNT = 200000; //Per job
+	static constexpr U64 WRITE_PERCENT = 5;
+
+	ConcurrentHashmap<U64, U64> map(KEY_COUNT);
+	for (U64 key = 0; key < KEY_COUNT; key += 2) { map.Insert(key, key * 3); }
+
+	//Counted per job so the jobs only share the map
+	U32 reads[JOB_COUNT]{};
+	U32 hits[JOB_COUNT]{};
+	U32 writes[JOB_COUNT]{};
+	U32 torn[JOB_COUNT]{};
+
+	Timer timer;
+	timer.Start();
+
+	//Every job mixes lookups with the odd insert or remove of a random key, a value that isn't key * 3 was read mid write
+	Jobs::Dispatch(JOB_COUNT, 1, [&](JobDispatchArgs args) {
+		U32 job = args.jobIndex;
+		U64 state = (job + 1) * 0x9E3779B97F4A7C15ull;
+
+		for (U32 i = 0; i < OPERATION_COUNT; ++i)
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+
+			U64 key = state % KEY_COUNT;
+
+			if ((state >> 32) % 100 < WRITE_PERCENT)
+			{
+				if (!map.Remove(key)) { map.Insert(key, key * 3); }
+				++writes[job];
+			}
+			else
+			{
+				U64 value;
+				if (map.Get(key, value)) { ++hits[job]; torn[job] += value != key * 3; }
+				++reads[job];
+			}
+		}
+	});
+
+	Jobs::Wait();
+
+	F64 seconds = timer.CurrentTime();
+
+	U64 readCount = 0, hitCount = 0, writeCount = 0, tornCount = 0;
+
+	for (U32 job = 0; job < JOB_COUNT; ++job)
+	{
+		readCount += reads[job];
+		hitCount += hits[job];
+		writeCount += writes[job];
+		tornCount += torn[job];
+	}
+
+	if (tornCount) { Logger::Error("ConcurrentHashmap: {} lookups returned a half written value", tornCount); }
+
+	Logger::Info("ConcurrentHashmap: {} jobs, {} reads ({} hits) and {} writes in {.3}ms, {.1} operations per ms, {} keys left",
+		JOB_COUNT, readCount, hitCount, writeCount, seconds * 1000.0, (readCount + writeCount) / (seconds * 1000.0), map.Size());
+}
+
+void Benchmarks::StringParsing()
+{
+	static constexpr U32 LINE_COUNT = 20000;
+
+	//A settings style file, "key = number flag" per line
+	String text;
+	for (U32 i = 0; i < LINE_COUNT; ++i)
+	{
+		text.Append("setting");
+		text.Append(i);
+		text.Append(" = ");
+		text.Append(i * 7);
+		text.Append(i & 1 ? " true\n" : " false\n");
+	}
+
+	Timer timer;
+	timer.Start();
+
+	//Every line, side and value is its own String
+	U64 splitSum = 0;
+	U32 splitFlags = 0;
+	Vector<String> lines = text.Split('\n', true);
+
+	for (String& line : lines)
+	{
+		if (line.Size())
+		{
+			Vector<String> sides = line.Split('=', true);
+			Vector<String> values = sides[1].Split(' ', true);
+
+			splitSum += values[0].ToType<U64>();
+			splitFlags += values[1].ToType<bool>();
+
+			for (String& value : values) { value.Destroy(); }
+			for (String& side : sides) { side.Destroy(); }
+		}
+
+		line.Destroy();
+	}
+
+	F64 splitSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	//The same walk over views into text
+	U64 viewSum = 0;
+	U32 viewFlags = 0;
+
+	for (const StringView& line : text.SplitView('\n', true))
+	{
+		if (line.Empty()) { continue; }
+
+		StringView values = line.SubView(line.IndexOf('=') + 1);
+		U32 field = 0;
+
+		for (const StringView& value : values.Tokenize(" "))
+		{
+			if (field++) { viewFlags += value.ToType<bool>(); }
+			else { viewSum += value.ToType<U64>(); }
+		}
+	}
+
+	F64 viewSeconds = timer.CurrentTime();
+
+	if (splitSum != viewSum || splitFlags != viewFlags) { Logger::Error("StringParsing: StringView tokens don't match Split's"); }
+
+	Logger::Info("StringParsing: {} lines, Split {.3}ms, StringView {.3}ms", LINE_COUNT, splitSeconds * 1000.0, viewSeconds * 1000.0);
+}
+
+void Benchmarks::StringSearch()
+{
+	static constexpr U32 LINE_COUNT = 32768;
+	static constexpr U32 SEARCH_COUNT = 50;
+
+	//About 2MB of shader like source
+	String source;
+	for (U32 i = 0; i < LINE_COUNT; ++i) { source.Append("\tvec4 color = texture(samplers[material.index], uv) * tint;\n"); }
+
+	const F64 gigabytes = source.Size() * SEARCH_COUNT / 1000000000.0;
+
+	//Nothing is found, so every search reads the whole string
+	Timer timer;
+	timer.Start();
+
+	I64 misses = 0;
+	for (U32 i = 0; i < SEARCH_COUNT; ++i) { misses += source.IndexOf('#'); }
+
+	F64 charSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	for (U32 i = 0; i < SEARCH_COUNT; ++i) { misses += source.LastIndexOf('#'); }
+
+	F64 lastSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	for (U32 i = 0; i < SEARCH_COUNT; ++i) { misses += source.IndexOf("texture(sampler2D"); }
+
+	F64 stringSeconds = timer.CurrentTime();
+
+	if (misses != -3 * (I64)SEARCH_COUNT) { Logger::Error("StringSearch: searches found text that isn't there"); }
+
+	//Growing then shrinking every line back
+	String replaced = source;
+	timer.Restart();
+
+	replaced.ReplaceAll("tint", "tintColor");
+	U64 grownSize = replaced.Size();
+	replaced.ReplaceAll("tintColor", "tint");
+
+	F64 replaceSeconds = timer.CurrentTime();
+
+	if (grownSize != source.Size() + LINE_COUNT * 5 || replaced != source) { Logger::Error("StringSearch: ReplaceAll doesn't round trip"); }
+
+	Logger::Info("StringSearch: {} bytes, IndexOf char {.2}GB/s, LastIndexOf char {.2}GB/s, IndexOf string {.2}GB/s, two ReplaceAll {.3}ms",
+		source.Size(), gigabytes / charSeconds, gigabytes / lastSeconds, gigabytes / stringSeconds, replaceSeconds * 1000.0);
+}
+
+void Benchmarks::NumberFormatting()
+{
+	static constexpr U32 NUMBER_COUNT = 100000;
+	static constexpr U32 TEXT_SIZE = 48;
+
+	//Random bit patterns cover every exponent, NaNs and infinities are skipped
+	F64* numbers;
+	C8* texts;
+	Memory::AllocateArray(&numbers, NUMBER_COUNT);
+	Memory::AllocateArray(&texts, NUMBER_COUNT * TEXT_SIZE);
+
+	Random::Seed(0x6E756D62);
+	for (U32 i = 0; i < NUMBER_COUNT;)
+	{
+		U64 bits = Random::RandomInt();
+		if ((bits & 0x7FF0000000000000ull) != 0x7FF0000000000000ull) { numbers[i++] = reinterpret_cast<F64&>(bits); }
+	}
+
+	Timer timer;
+	timer.Start();
+
+	for (U32 i = 0; i < NUMBER_COUNT; ++i) { snprintf(texts + i * TEXT_SIZE, TEXT_SIZE, "%.17g", numbers[i]); }
+
+	F64 printfSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	U32 mismatches = 0;
+	for (U32 i = 0; i < NUMBER_COUNT; ++i) { mismatches += strtod(texts + i * TEXT_SIZE, nullptr) != numbers[i]; }
+
+	F64 strtodSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	for (U32 i = 0; i < NUMBER_COUNT; ++i)
+	{
+		C8* text = texts + i * TEXT_SIZE;
+		text[NumberText::WriteShortest(text, numbers[i])] = '\0';
+	}
+
+	F64 writeSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	for (U32 i = 0; i < NUMBER_COUNT; ++i)
+	{
+		const C8* text = texts + i * TEXT_SIZE;
+		F64 value;
+		NumberText::ReadFloat(text, text + Length(text), value);
+		mismatches += value != numbers[i];
+	}
+
+	F64 readSeconds = timer.CurrentTime();
+
+	//strtod has to agree on the shorter text too
+	for (U32 i = 0; i < NUMBER_COUNT; ++i) { mismatches += strtod(texts + i * TEXT_SIZE, nullptr) != numbers[i]; }
+
+	if (mismatches) { Logger::Error("NumberFormatting: {} floats didn't round trip", mismatches); }
+
+	//F32 takes its own shortest text, a random sample of bit patterns against itself and strtof
+	U32 floatMismatches = 0;
+
+	for (U32 i = 0; i < NUMBER_COUNT * 10; ++i)
+	{
+		U32 bits = (U32)Random::RandomInt();
+		if ((bits & 0x7F800000) == 0x7F800000) { continue; }
+
+		F32 number = reinterpret_cast<F32&>(bits);
+		C8 text[TEXT_SIZE];
+		text[NumberText::WriteShortest(text, number)] = '\0';
+
+		F32 value;
+		NumberText::ReadFloat(text, text + Length(text), value);
+		F32 expected = strtof(text, nullptr);
+		floatMismatches += reinterpret_cast<U32&>(value) != bits || reinterpret_cast<U32&>(expected) != bits;
+	}
+
+	if (floatMismatches) { Logger::Error("NumberFormatting: {} F32s didn't round trip", floatMismatches); }
+
+	//Integers of every length
+	timer.Restart();
+
+	for (U32 i = 0; i < NUMBER_COUNT; ++i) { snprintf(texts + i * TEXT_SIZE, TEXT_SIZE, "%llu", Random::RandomInt() >> (i & 63)); }
+
+	F64 printfIntSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	U64 intSum = 0;
+	for (U32 i = 0; i < NUMBER_COUNT; ++i) { intSum += strtoull(texts + i * TEXT_SIZE, nullptr, 10); }
+
+	F64 strtoullSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	U64 readSum = 0;
+	for (U32 i = 0; i < NUMBER_COUNT; ++i)
+	{
+		const C8* text = texts + i * TEXT_SIZE;
+		U64 value;
+		NumberText::ReadUnsigned(text, text + Length(text), value);
+		readSum += value;
+	}
+
+	F64 readIntSeconds = timer.CurrentTime();
+
+	if (readSum != intSum) { Logger::Error("NumberFormatting: ReadUnsigned doesn't match strtoull"); }
+
+	String text;
+	timer.Restart();
+
+	U64 writeLength = 0;
+	for (U32 i = 0; i < NUMBER_COUNT; ++i) { text = Random::RandomInt() >> (i & 63); writeLength += text.Size(); }
+
+	F64 writeIntSeconds = timer.CurrentTime();
+
+	Memory::Free(&numbers);
+	Memory::Free(&texts);
+
+	const F64 nanoseconds = 1000000000.0 / NUMBER_COUNT;
+
+	Logger::Info("NumberFormatting: floats, snprintf {.1}ns, WriteShortest {.1}ns, strtod {.1}ns, ReadFloat {.1}ns",
+		printfSeconds * nanoseconds, writeSeconds * nanoseconds, strtodSeconds * nanoseconds, readSeconds * nanoseconds);
+	Logger::Info("NumberFormatting: integers, snprintf {.1}ns, String {.1}ns, strtoull {.1}ns, ReadUnsigned {.1}ns, {} digits",
+		printfIntSeconds * nanoseconds, writeIntSeconds * nanoseconds, strtoullSeconds * nanoseconds, readIntSeconds * nanoseconds, writeLength);
+}
+
+void Benchmarks::FormatLines()
+{
+	static constexpr U32 LINE_COUNT = 200000;
+
+	C8 buffer[256];
+	Timer timer;
+	timer.Start();
+
+	U64 printfLength = 0;
+	for (U32 i = 0; i < LINE_COUNT; ++i)
+	{
+		printfLength += snprintf(buffer, sizeof(buffer), "Chunk %u at %dx%d: %llu tiles, %s, %.2fms", i, (I32)(i & 1023) - 512, (I32)(i >> 10), (U64)i * 4096, "settled", i * 0.001);
+	}
+
+	F64 printfSeconds = timer.CurrentTime();
+
+	//A line reused like a log buffer only allocates on the first Format
+	String line;
+	timer.Restart();
+
+	U64 formatLength = 0;
+	for (U32 i = 0; i < LINE_COUNT; ++i)
+	{
+		line.Format("Chunk {} at {}x{}: {} tiles, {}, {.2}ms", i, (I32)(i & 1023) - 512, (I32)(i >> 10), (U64)i * 4096, "settled", i * 0.001);
+		formatLength += line.Size();
+	}
+
+	F64 formatSeconds = timer.CurrentTime();
+	timer.Restart();
+
+	U64 freshLength = 0;
+	for (U32 i = 0; i < LINE_COUNT; ++i)
+	{
+		String fresh;
+		fresh.Format("Chunk {} at {}x{}: {} tiles, {}, {.2}ms", i, (I32)(i & 1023) - 512, (I32)(i >> 10), (U64)i * 4096, "settled", i * 0.001);
+		freshLength += fresh.Size();
+	}
+
+	F64 freshSeconds = timer.CurrentTime();
+
+	if (formatLength != printfLength || freshLength != printfLength) { Logger::Error("FormatLines: Format wrote {} characters, snprintf {}", formatLength, printfLength); }
+
+	Logger::Info("FormatLines: snprintf {} lines/s, Format {} lines/s reusing a String, {} lines/s with a new String each",
+		(U64)(LINE_COUNT / printfSeconds), (U64)(LINE_COUNT / formatSeconds), (U64)(LINE_COUNT / freshSeconds));
+}
\ No newline at end of file
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+/*
+* Timings for the world systems, run on startup when TIMESLIP_BENCHMARKS is defined
+* Each benchmark works on its own generated world and leaves World to be reinitialized afterwards
+*/
+class Benchmarks
+{
+public:
+	static void Run();
+
+private:
+	static void LiquidFlood();
+	static void LightingUpdates();
+	static void SnapshotHistory();
+	static void HistoryScrub();
+	static void PathQueries();
+	static void CollisionBodies();
+	static void Raycasts();
+	static void EntityIteration();
+	static void SpatialQueries();
+	static void GrassGrowth();
+	static void CaveIn();
+	static void TileEntityLookups();
+	static void MinimapUpdates();
+	static void ExplorationMap();
+	static void Sorting();
+	static void SmallLists();
+	static void PoolHandles();
+	static void FreeSlots();
+	static void ConcurrentLookups();
+	static void StringParsing();
+	static void StringSearch();
+	static void NumberFormatting();
+	static void FormatLines();
+
+	STATIC_CLASS(Benchmarks);
+};
\ No newline at end of file
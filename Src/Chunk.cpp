@@ -5,6 +5,8 @@
 #include "Timeslip.hpp"
 #include "World.hpp"
 #include "Tile.hpp"
+#include "Liquid.hpp"
+#include "Lighting.hpp"
 
 void Chunk::Create(const Vector2Int& position_, TileInstance* wallInstances, TileInstance* blockInstances, TileInstance* decorationInstances, U32 offset)
 {
@@ -32,6 +34,9 @@ void Chunk::Load(U8 direction)
 
 void Chunk::LoadTiles()
 {
+	U32 chunkIndex = World::ChunkIndex(this);
+	World::dirtyChunks[chunkIndex >> 6] &= ~(1ull << (chunkIndex & 63));
+
 	Vector2 pos = position * Vector2{ TILE_WIDTH, TILE_HEIGHT };
 
 	Tile* tile = World::GetTile(position.x, position.y);
@@ -51,12 +56,13 @@ void Chunk::LoadTiles()
 			Tile* bottomTile = World::GetTile(position.x + x, position.y + y - 1);
 
 			F32 variation = (((position.x + x) ^ 2 * (position.y + y) + Math::Abs(World::SEED)) % 3) * TILE_TEX_WIDTH;
+			F32 brightness = Lighting::Brightness((U32)(tile - World::tiles));
 
 			decorationInstance->position = pos;
 			decorationInstance->texcoord = { variation, 0.0f };
 			decorationInstance->maskTexcoord = Vector2Zero;
-			decorationInstance->color = Vector3One;
-			decorationInstance->texIndex = Timeslip::GetTextureIndex(2, tile->decoration);
+			decorationInstance->color = Vector3One * brightness;
+			decorationInstance->texIndex = Timeslip::GetTextureIndex(TILE_LAYER_DECORATION, tile->decoration);
 			decorationInstance->maskIndex = U16_MAX;
 
 			Vector2 mask = {
@@ -67,8 +73,8 @@ void Chunk::LoadTiles()
 			blockInstance->position = pos;
 			blockInstance->texcoord = { variation, 0.0f };
 			blockInstance->maskTexcoord = mask;
-			blockInstance->color = Vector3One;
-			blockInstance->texIndex = Timeslip::GetTextureIndex(1, tile->block);
+			blockInstance->color = Vector3One * brightness;
+			blockInstance->texIndex = Timeslip::GetTextureIndex(TILE_LAYER_BLOCK, tile->block);
 			blockInstance->maskIndex = Timeslip::GetMaskIndex(0);
 
 			mask = {
@@ -79,8 +85,8 @@ void Chunk::LoadTiles()
 			wallInstance->position = pos;
 			wallInstance->texcoord = { variation, 0.0f };
 			wallInstance->maskTexcoord = mask;
-			wallInstance->color = Vector3One;
-			wallInstance->texIndex = Timeslip::GetTextureIndex(0, tile->wall);
+			wallInstance->color = Math::Lerp(Vector3One, LIQUID_COLOR, tile->liquidAmt / (F32)LIQUID_MAX) * brightness;
+			wallInstance->texIndex = Timeslip::GetTextureIndex(TILE_LAYER_WALL, tile->wall);
 			wallInstance->maskIndex = Timeslip::GetMaskIndex(0);
 
 			pos.x += TILE_WIDTH;
@@ -0,0 +1,293 @@
+#include "Collision.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Platform\Jobs.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "TileRegistry.hpp"
+
+U64* Collision::solidMasks{ nullptr };
+
+//Tiles a span covers, an edge lying exactly on a tile boundary doesn't cover the tile past it
+static bool TileRange(F32 min, F32 max, I32 count, I32& first, I32& last)
+{
+	first = Math::Max((I32)Math::Floor(min + COLLISION_SKIN), 0);
+	last = Math::Min((I32)Math::Floor(max - COLLISION_SKIN), count - 1);
+
+	return first <= last;
+}
+
+void Collision::Initialize()
+{
+	Memory::AllocateStaticArray(&solidMasks, TOTAL_CHUNK_COUNT);
+}
+
+void Collision::Build()
+{
+	U32 chunkCount = (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y;
+
+	Jobs::Dispatch(chunkCount, 256, [](JobDispatchArgs args) {
+		const Tile* tile = World::tiles + World::FirstTile(args.jobIndex);
+		U64 mask = 0;
+
+		for (U32 y = 0; y < CHUNK_SIZE; ++y)
+		{
+			for (U32 x = 0; x < CHUNK_SIZE; ++x)
+			{
+				if (BLOCKS.solid[tile[x].block]) { mask |= 1ull << (x | (y << CHUNK_SHIFT)); }
+			}
+
+			tile += World::TILE_COUNT_X;
+		}
+
+		solidMasks[args.jobIndex] = mask;
+	});
+
+	Jobs::Wait();
+}
+
+void Collision::SetSolid(U32 index, bool solid)
+{
+	U32 x = index % World::TILE_COUNT_X;
+	U32 y = index / World::TILE_COUNT_X;
+	U64& mask = solidMasks[World::ChunkIndex(index)];
+
+	if (solid) { mask |= ChunkBit(x, y); }
+	else { mask &= ~ChunkBit(x, y); }
+}
+
+void Collision::Move(CollisionBody& body, F32 deltaTime)
+{
+	//Tile space, one unit per tile with the world's bottom left corner at the origin
+	F32 centerX = body.position.x / TILE_WIDTH + World::TILE_OFFSET_X;
+	F32 centerY = body.position.y / TILE_HEIGHT + World::TILE_OFFSET_Y;
+	F32 halfWidth = body.halfExtents.x / TILE_WIDTH;
+	F32 halfHeight = body.halfExtents.y / TILE_HEIGHT;
+
+	F32 minX = centerX - halfWidth;
+	F32 maxX = centerX + halfWidth;
+	F32 minY = centerY - halfHeight;
+	F32 maxY = centerY + halfHeight;
+
+	F32 dx = body.velocity.x * deltaTime / TILE_WIDTH;
+	F32 dy = body.velocity.y * deltaTime / TILE_HEIGHT;
+
+	body.contacts = COLLISION_CONTACT_NONE;
+
+	//Vertical first, a body landing this tick slides along the ground instead of catching on its edge
+	I32 left, right;
+	if (TileRange(minX, maxX, World::TILE_COUNT_X, left, right)) { dy = SweepY(minY, maxY, left, right, dy, body.contacts); }
+
+	minY += dy;
+	maxY += dy;
+
+	I32 bottom, top;
+	if (TileRange(minY, maxY, World::TILE_COUNT_Y, bottom, top)) { dx = SweepX(minX, maxX, bottom, top, dx, body.contacts); }
+
+	body.position.x += dx * TILE_WIDTH;
+	body.position.y += dy * TILE_HEIGHT;
+
+	if (body.contacts & (COLLISION_CONTACT_LEFT | COLLISION_CONTACT_RIGHT)) { body.velocity.x = 0.0f; }
+	if (body.contacts & (COLLISION_CONTACT_FLOOR | COLLISION_CONTACT_CEILING)) { body.velocity.y = 0.0f; }
+}
+
+void Collision::MoveBodies(CollisionBody* bodies, U32 count, F32 deltaTime)
+{
+	Jobs::Dispatch(count, COLLISION_GROUP_SIZE, [bodies, deltaTime](JobDispatchArgs args) { Move(bodies[args.jobIndex], deltaTime); });
+	Jobs::Wait();
+}
+
+bool Collision::Overlaps(const Vector2& min, const Vector2& max)
+{
+	I32 left, bottom, right, top;
+	if (!World::TileBounds(min, max, left, bottom, right, top)) { return false; }
+
+	I32 column;
+	return FindColumn(left, right, bottom, top, column);
+}
+
+F32 Collision::SweepX(F32 minX, F32 maxX, I32 bottom, I32 top, F32 distance, U8& contacts)
+{
+	const I32 width = World::TILE_COUNT_X;
+	I32 column;
+
+	if (distance > 0.0f)
+	{
+		//Columns the right edge enters, the world's sides are walls
+		I32 from = (I32)Math::Floor(maxX - COLLISION_SKIN) + 1;
+		I32 to = (I32)Math::Floor(maxX + distance - COLLISION_SKIN);
+
+		if (to < from) { return distance; }
+
+		if (from < width && FindColumn(from, Math::Min(to, width - 1), bottom, top, column))
+		{
+			contacts |= COLLISION_CONTACT_RIGHT;
+			return column - maxX;
+		}
+
+		if (to >= width)
+		{
+			contacts |= COLLISION_CONTACT_RIGHT;
+			return width - maxX;
+		}
+	}
+	else if (distance < 0.0f)
+	{
+		I32 from = (I32)Math::Floor(minX + COLLISION_SKIN) - 1;
+		I32 to = (I32)Math::Floor(minX + distance + COLLISION_SKIN);
+
+		if (to > from) { return distance; }
+
+		if (from >= 0 && FindColumn(from, Math::Max(to, 0), bottom, top, column))
+		{
+			contacts |= COLLISION_CONTACT_LEFT;
+			return column + 1 - minX;
+		}
+
+		if (to < 0)
+		{
+			contacts |= COLLISION_CONTACT_LEFT;
+			return -minX;
+		}
+	}
+
+	return distance;
+}
+
+F32 Collision::SweepY(F32 minY, F32 maxY, I32 left, I32 right, F32 distance, U8& contacts)
+{
+	const I32 height = World::TILE_COUNT_Y;
+	I32 row;
+
+	if (distance > 0.0f)
+	{
+		I32 from = (I32)Math::Floor(maxY - COLLISION_SKIN) + 1;
+		I32 to = (I32)Math::Floor(maxY + distance - COLLISION_SKIN);
+
+		if (to < from) { return distance; }
+
+		if (from < height && FindRow(from, Math::Min(to, height - 1), left, right, row))
+		{
+			contacts |= COLLISION_CONTACT_CEILING;
+			return row - maxY;
+		}
+
+		if (to >= height)
+		{
+			contacts |= COLLISION_CONTACT_CEILING;
+			return height - maxY;
+		}
+	}
+	else if (distance < 0.0f)
+	{
+		I32 from = (I32)Math::Floor(minY + COLLISION_SKIN) - 1;
+		I32 to = (I32)Math::Floor(minY + distance + COLLISION_SKIN);
+
+		if (to > from) { return distance; }
+
+		if (from >= 0 && FindRow(from, Math::Max(to, 0), left, right, row))
+		{
+			contacts |= COLLISION_CONTACT_FLOOR;
+			return row + 1 - minY;
+		}
+
+		if (to < 0)
+		{
+			contacts |= COLLISION_CONTACT_FLOOR;
+			return -minY;
+		}
+	}
+
+	return distance;
+}
+
+bool Collision::FindColumn(I32 from, I32 to, I32 bottom, I32 top, I32& column)
+{
+	//Nearest solid column to from, scanning toward to, inside rows bottom to top
+	I32 step = to >= from ? 1 : -1;
+	I32 first = Math::Min(from, to);
+	I32 last = Math::Max(from, to);
+
+	for (I32 chunkX = from >> CHUNK_SHIFT; ; chunkX += step)
+	{
+		U64 mask = 0;
+
+		for (I32 chunkY = bottom >> CHUNK_SHIFT; chunkY <= top >> CHUNK_SHIFT; ++chunkY)
+		{
+			mask |= solidMasks[chunkX + chunkY * World::CHUNK_COUNT_X] & RowBand(chunkY, bottom, top);
+		}
+
+		//Fold the rows onto the low byte, bit x is set if column x has a solid tile
+		mask |= mask >> 32;
+		mask |= mask >> 16;
+		mask |= mask >> 8;
+
+		U64 columns = mask & Band(chunkX, first, last);
+
+		if (columns)
+		{
+			column = (chunkX << CHUNK_SHIFT) + (I32)(step > 0 ? FirstSetBit(columns) : LastSetBit(columns));
+			return true;
+		}
+
+		if (chunkX == to >> CHUNK_SHIFT) { return false; }
+	}
+}
+
+bool Collision::FindRow(I32 from, I32 to, I32 left, I32 right, I32& row)
+{
+	I32 step = to >= from ? 1 : -1;
+	I32 first = Math::Min(from, to);
+	I32 last = Math::Max(from, to);
+
+	for (I32 chunkY = from >> CHUNK_SHIFT; ; chunkY += step)
+	{
+		U64 mask = 0;
+
+		for (I32 chunkX = left >> CHUNK_SHIFT; chunkX <= right >> CHUNK_SHIFT; ++chunkX)
+		{
+			mask |= solidMasks[chunkX + chunkY * World::CHUNK_COUNT_X] & ColumnBand(chunkX, left, right);
+		}
+
+		//Fold each row onto its lowest bit, then gather those 8 bits into one byte, bit y is set if row y has a solid tile
+		mask |= mask >> 4;
+		mask |= mask >> 2;
+		mask |= mask >> 1;
+
+		U64 rows = ((mask & 0x0101010101010101ull) * 0x0102040810204080ull) >> 56;
+		rows &= Band(chunkY, first, last);
+
+		if (rows)
+		{
+			row = (chunkY << CHUNK_SHIFT) + (I32)(step > 0 ? FirstSetBit(rows) : LastSetBit(rows));
+			return true;
+		}
+
+		if (chunkY == to >> CHUNK_SHIFT) { return false; }
+	}
+}
+
+U64 Collision::RowBand(I32 chunkY, I32 bottom, I32 top)
+{
+	//Every bit of the chunk's rows from bottom to top
+	I32 low = Math::Max(bottom - (chunkY << CHUNK_SHIFT), 0);
+	I32 high = Math::Min(top - (chunkY << CHUNK_SHIFT), (I32)CHUNK_MASK);
+
+	return (U64_MAX << (low << CHUNK_SHIFT)) & (U64_MAX >> ((CHUNK_MASK - high) << CHUNK_SHIFT));
+}
+
+U64 Collision::ColumnBand(I32 chunkX, I32 left, I32 right)
+{
+	//Every bit of the chunk's columns from left to right
+	return Band(chunkX, left, right) * 0x0101010101010101ull;
+}
+
+U64 Collision::Band(I32 chunk, I32 first, I32 last)
+{
+	//One bit for each of the chunk's 8 rows or columns from first to last
+	I32 low = Math::Max(first - (chunk << CHUNK_SHIFT), 0);
+	I32 high = Math::Min(last - (chunk << CHUNK_SHIFT), (I32)CHUNK_MASK);
+
+	return (0xFFull << low) & (0xFFull >> (CHUNK_MASK - high));
+}
\ No newline at end of file
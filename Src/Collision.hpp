@@ -0,0 +1,64 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+constexpr U32 COLLISION_GROUP_SIZE = 256;
+constexpr F32 COLLISION_SKIN = 0.001f; //In tiles, an edge resting on a tile doesn't count as inside it
+
+enum CollisionContact
+{
+	COLLISION_CONTACT_NONE = 0x00,
+	COLLISION_CONTACT_LEFT = 0x01,
+	COLLISION_CONTACT_RIGHT = 0x02,
+	COLLISION_CONTACT_FLOOR = 0x04,
+	COLLISION_CONTACT_CEILING = 0x08,
+};
+
+/// <summary>
+/// Axis aligned box moved through the tile grid, position is its center in world units
+/// </summary>
+struct CollisionBody
+{
+	Vector2 position;
+	Vector2 halfExtents;
+	Vector2 velocity;
+	U8 contacts; //CollisionContact flags from the last move
+};
+
+/*
+* Swept AABB collision against solid tiles (any tile with a block)
+*
+* Each chunk keeps a 64-bit mask of its solid tiles, kept up to date by World::ReplaceTile. A move is split into a
+* vertical then a horizontal sweep, each sweep checks every tile the box's leading edge passes over so fast bodies
+* can't tunnel. The swept rows or columns are gathered a chunk at a time: the chunk masks are ANDed with the band
+* the box covers, folded into one byte of occupied columns (or rows) and the nearest one is a bit scan away. Empty
+* chunks cost a load and a compare
+*
+* MoveBodies moves a batch on Jobs workers, the grid is only read so bodies don't need any ordering
+*/
+class Collision
+{
+public:
+	static void Move(CollisionBody& body, F32 deltaTime);
+	static void MoveBodies(CollisionBody* bodies, U32 count, F32 deltaTime);
+	static bool Overlaps(const Vector2& min, const Vector2& max);
+
+private:
+	static void Initialize();
+	static void Build();
+	static void SetSolid(U32 index, bool solid);
+
+	static F32 SweepX(F32 minX, F32 maxX, I32 bottom, I32 top, F32 distance, U8& contacts);
+	static F32 SweepY(F32 minY, F32 maxY, I32 left, I32 right, F32 distance, U8& contacts);
+	static bool FindColumn(I32 from, I32 to, I32 bottom, I32 top, I32& column);
+	static bool FindRow(I32 from, I32 to, I32 left, I32 right, I32& row);
+	static U64 RowBand(I32 chunkY, I32 bottom, I32 top);
+	static U64 ColumnBand(I32 chunkX, I32 left, I32 right);
+	static U64 Band(I32 chunk, I32 first, I32 last);
+
+	static U64* solidMasks;
+
+	STATIC_CLASS(Collision);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
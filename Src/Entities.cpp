@@ -0,0 +1,174 @@
+#include "Entities.hpp"
+
+Archetype Entities::archetypes[ENTITY_MAX_ARCHETYPES];
+U32 Entities::archetypeCount{ 0 };
+U32 Entities::componentSizes[ENTITY_MAX_COMPONENTS];
+U32 Entities::componentCount{ 0 };
+Vector<EntityRecord> Entities::records;
+Vector<U32> Entities::freeIndices;
+U32 Entities::aliveCount{ 0 };
+
+void Entities::Shutdown()
+{
+	for (U32 i = 0; i < archetypeCount; ++i)
+	{
+		for (U8* chunk : archetypes[i].chunks) { Memory::Free(&chunk); }
+		archetypes[i].chunks.Destroy();
+	}
+
+	archetypeCount = 0;
+	aliveCount = 0;
+	records.Destroy();
+	freeIndices.Destroy();
+}
+
+void Entities::Destroy(Entity entity)
+{
+	if (!Alive(entity)) { return; }
+
+	EntityRecord& record = records[entity.index];
+	RemoveRow(record.archetype, record.row);
+
+	record.archetype = U32_MAX;
+	++record.generation;
+	freeIndices.Push(entity.index);
+	--aliveCount;
+}
+
+bool Entities::Alive(Entity entity)
+{
+	return entity.index < records.Size() && records[entity.index].generation == entity.generation && records[entity.index].archetype != U32_MAX;
+}
+
+U32 Entities::Count()
+{
+	return aliveCount;
+}
+
+U32 Entities::RegisterComponent(U32 size)
+{
+	if (componentCount == ENTITY_MAX_COMPONENTS) { BreakPoint; }
+
+	componentSizes[componentCount] = size;
+	return componentCount++;
+}
+
+U32 Entities::FindArchetype(U64 mask)
+{
+	for (U32 i = 0; i < archetypeCount; ++i)
+	{
+		if (archetypes[i].mask == mask) { return i; }
+	}
+
+	if (archetypeCount == ENTITY_MAX_ARCHETYPES) { BreakPoint; }
+
+	Archetype& archetype = archetypes[archetypeCount];
+	archetype.mask = mask;
+	archetype.count = 0;
+
+	//Leave room to align every column
+	U64 rowSize = sizeof(Entity);
+	for (U64 bits = mask; bits; bits &= bits - 1) { rowSize += componentSizes[FirstSetBit(bits)]; }
+
+	archetype.capacity = (U32)((ENTITY_CHUNK_SIZE - ENTITY_COLUMN_ALIGNMENT * (BitCount(mask) + 1)) / rowSize);
+
+	U64 offset = Memory::MemoryAlign(sizeof(Entity) * archetype.capacity, ENTITY_COLUMN_ALIGNMENT);
+
+	for (U64 bits = mask; bits; bits &= bits - 1)
+	{
+		U64 id = FirstSetBit(bits);
+		archetype.offsets[id] = (U32)offset;
+		offset = Memory::MemoryAlign(offset + componentSizes[id] * archetype.capacity, ENTITY_COLUMN_ALIGNMENT);
+	}
+
+	return archetypeCount++;
+}
+
+Entity Entities::NewHandle()
+{
+	Entity entity;
+
+	if (freeIndices.Size())
+	{
+		freeIndices.Pop(entity.index);
+		entity.generation = records[entity.index].generation;
+	}
+	else
+	{
+		entity.index = (U32)records.Size();
+		records.Push({ U32_MAX, 0, 0 });
+	}
+
+	++aliveCount;
+	return entity;
+}
+
+U32 Entities::AddRow(U32 archetypeIndex, Entity entity)
+{
+	Archetype& archetype = archetypes[archetypeIndex];
+	U32 row = archetype.count++;
+	U32 chunk = row / archetype.capacity;
+
+	if (chunk == archetype.chunks.Size())
+	{
+		U8* memory;
+		Memory::AllocateSize(&memory, ENTITY_CHUNK_SIZE);
+		archetype.chunks.Push(memory);
+	}
+
+	EntityColumn(archetype, chunk)[row % archetype.capacity] = entity;
+
+	EntityRecord& record = records[entity.index];
+	record.archetype = archetypeIndex;
+	record.row = row;
+
+	return row;
+}
+
+void Entities::RemoveRow(U32 archetypeIndex, U32 row)
+{
+	Archetype& archetype = archetypes[archetypeIndex];
+	U32 last = --archetype.count;
+
+	if (row == last) { return; }
+
+	//Fill the hole with the last entity so the archetype stays dense
+	Entity moved = EntityColumn(archetype, last / archetype.capacity)[last % archetype.capacity];
+	EntityColumn(archetype, row / archetype.capacity)[row % archetype.capacity] = moved;
+
+	for (U64 bits = archetype.mask; bits; bits &= bits - 1)
+	{
+		U32 id = (U32)FirstSetBit(bits);
+		Memory::Copy(ComponentData(archetypeIndex, id, row), ComponentData(archetypeIndex, id, last), componentSizes[id]);
+	}
+
+	records[moved.index].row = row;
+}
+
+void Entities::MoveEntity(Entity entity, U64 mask)
+{
+	U32 from = records[entity.index].archetype;
+	U32 row = records[entity.index].row;
+	U32 to = FindArchetype(mask);
+	U32 newRow = AddRow(to, entity);
+
+	for (U64 bits = archetypes[from].mask & mask; bits; bits &= bits - 1)
+	{
+		U32 id = (U32)FirstSetBit(bits);
+		Memory::Copy(ComponentData(to, id, newRow), ComponentData(from, id, row), componentSizes[id]);
+	}
+
+	RemoveRow(from, row);
+}
+
+U8* Entities::ComponentData(U32 archetypeIndex, U32 component, U32 row)
+{
+	const Archetype& archetype = archetypes[archetypeIndex];
+
+	return archetype.chunks[row / archetype.capacity] + archetype.offsets[component] + (U64)(row % archetype.capacity) * componentSizes[component];
+}
+
+Entity* Entities::EntityColumn(const Archetype& archetype, U32 chunk)
+{
+	return (Entity*)archetype.chunks[chunk];
+}
\ No newline at end of file
@@ -0,0 +1,293 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+#include "Containers\SmallVector.hpp"
+#include "Memory\Memory.hpp"
+#include "Platform\Jobs.hpp"
+
+constexpr U32 ENTITY_MAX_COMPONENTS = 64; //One bit each in an archetype's mask
+constexpr U32 ENTITY_MAX_ARCHETYPES = 256;
+constexpr U64 ENTITY_CHUNK_SIZE = 16384; //One 16kb region from Memory
+constexpr U64 ENTITY_COLUMN_ALIGNMENT = 16;
+constexpr U64 ENTITY_INLINE_CHUNKS = 4; //Most archetypes never need more chunks than this
+constexpr U64 ENTITY_INLINE_MATCHES = 8; //Archetypes a query holds before its list goes to Memory
+
+/// <summary>
+/// Generational handle, a handle to a destroyed entity fails every lookup even after its index is reused
+/// </summary>
+struct Entity
+{
+	U32 index{ U32_MAX };
+	U32 generation{ 0 };
+
+	bool operator==(const Entity& other) const { return index == other.index && generation == other.generation; }
+};
+
+struct EntityRecord
+{
+	U32 archetype;
+	U32 row;
+	U32 generation;
+};
+
+/// <summary>
+/// Every entity with one exact set of components, each chunk holds capacity entities as a column per component
+/// </summary>
+struct Archetype
+{
+	U64 mask;
+	U32 capacity;
+	U32 count;
+	U32 offsets[ENTITY_MAX_COMPONENTS]; //Where each component's column starts in a chunk
+	SmallVector<U8*, ENTITY_INLINE_CHUNKS> chunks;
+};
+
+struct EntityChunkRef
+{
+	U32 archetype;
+	U32 chunk;
+	U32 count;
+};
+
+struct Velocity
+{
+	Vector3 linear;
+};
+
+/*
+* Archetype entity storage
+*
+* Entities with the same set of components share an archetype, which stores them densely in ENTITY_CHUNK_SIZE chunks:
+* the entity handles first, then one column per component. Iterating a component is a linear walk over contiguous
+* memory and adding or removing a component moves the entity to the archetype of its new set
+*
+* Components must be trivially copyable, they're moved around with Memory::Copy. Each component type gets an id the
+* first time it's used, an archetype's mask has the bit of each of its components
+*
+* Removing an entity swaps the archetype's last entity into its row, rows and chunk memory are never given back
+* until Shutdown. Archetypes are only ever appended, which lets EntityQuery cache its matches
+*/
+class Entities
+{
+public:
+	template <class... Components> static Entity Create(const Components&... components);
+	static void Destroy(Entity entity);
+	static bool Alive(Entity entity);
+	static U32 Count();
+
+	template <class Component> static Component* Get(Entity entity);
+	template <class Component> static void Add(Entity entity, const Component& component);
+	template <class Component> static void Remove(Entity entity);
+
+	template <class Component> static U32 ComponentId();
+	template <class... Components> static U64 ComponentMask();
+
+private:
+	static void Shutdown();
+
+	static U32 RegisterComponent(U32 size);
+	static U32 FindArchetype(U64 mask);
+	static Entity NewHandle();
+	static U32 AddRow(U32 archetypeIndex, Entity entity);
+	static void RemoveRow(U32 archetypeIndex, U32 row);
+	static void MoveEntity(Entity entity, U64 mask);
+	static U8* ComponentData(U32 archetypeIndex, U32 component, U32 row);
+	static Entity* EntityColumn(const Archetype& archetype, U32 chunk);
+
+	static Archetype archetypes[ENTITY_MAX_ARCHETYPES];
+	static U32 archetypeCount;
+	static U32 componentSizes[ENTITY_MAX_COMPONENTS];
+	static U32 componentCount;
+	static Vector<EntityRecord> records;
+	static Vector<U32> freeIndices;
+	static U32 aliveCount;
+
+	STATIC_CLASS(Entities);
+	template <class...> friend class EntityQuery;
+	friend class Timeslip;
+	friend class Benchmarks;
+};
+
+/*
+* Every entity that has at least Components, matching archetypes are found once and only archetypes created since
+* the last use are checked again. func is called as func(Entity, Components&...)
+*
+* ParallelForEach runs each chunk as its own job, func must only touch the entity it's given
+*/
+template <class... Components>
+class EntityQuery
+{
+public:
+	template <class Func> void ForEach(Func&& func);
+	template <class Func> void ParallelForEach(Func&& func);
+	U32 Count();
+
+	void Destroy();
+
+private:
+	void Refresh();
+	template <class Func> static void RunChunk(const EntityChunkRef& ref, Func& func);
+	template <class Func> static void RunColumns(const Entity* entities, U32 count, Func& func, Components*... columns);
+
+	SmallVector<U32, ENTITY_INLINE_MATCHES> matches;
+	Vector<EntityChunkRef> work;
+	U32 checkedCount{ 0 };
+};
+
+template <class... Components>
+inline Entity Entities::Create(const Components&... components)
+{
+	U32 archetypeIndex = FindArchetype(ComponentMask<Components...>());
+	Entity entity = NewHandle();
+	U32 row = AddRow(archetypeIndex, entity);
+
+	(Memory::Copy(ComponentData(archetypeIndex, ComponentId<Components>(), row), &components, sizeof(Components)), ...);
+
+	return entity;
+}
+
+template <class Component>
+inline Component* Entities::Get(Entity entity)
+{
+	if (!Alive(entity)) { return nullptr; }
+
+	const EntityRecord& record = records[entity.index];
+	U32 id = ComponentId<Component>();
+
+	if (!(archetypes[record.archetype].mask & (1ull << id))) { return nullptr; }
+
+	return (Component*)ComponentData(record.archetype, id, record.row);
+}
+
+template <class Component>
+inline void Entities::Add(Entity entity, const Component& component)
+{
+	if (!Alive(entity)) { return; }
+
+	U64 bit = 1ull << ComponentId<Component>();
+	if (!(archetypes[records[entity.index].archetype].mask & bit)) { MoveEntity(entity, archetypes[records[entity.index].archetype].mask | bit); }
+
+	const EntityRecord& record = records[entity.index];
+	Memory::Copy(ComponentData(record.archetype, ComponentId<Component>(), record.row), &component, sizeof(Component));
+}
+
+template <class Component>
+inline void Entities::Remove(Entity entity)
+{
+	if (!Alive(entity)) { return; }
+
+	U64 bit = 1ull << ComponentId<Component>();
+	U64 mask = archetypes[records[entity.index].archetype].mask;
+
+	if (mask & bit) { MoveEntity(entity, mask & ~bit); }
+}
+
+template <class Component>
+inline U32 Entities::ComponentId()
+{
+	static const U32 id = RegisterComponent(sizeof(Component));
+	return id;
+}
+
+template <class... Components>
+inline U64 Entities::ComponentMask()
+{
+	return (0ull | ... | (1ull << ComponentId<Components>()));
+}
+
+template <class... Components>
+template <class Func>
+inline void EntityQuery<Components...>::ForEach(Func&& func)
+{
+	Refresh();
+
+	for (U32 archetypeIndex : matches)
+	{
+		const Archetype& archetype = Entities::archetypes[archetypeIndex];
+
+		for (U32 chunk = 0, remaining = archetype.count; remaining; ++chunk)
+		{
+			U32 count = Math::Min(remaining, archetype.capacity);
+			RunChunk({ archetypeIndex, chunk, count }, func);
+			remaining -= count;
+		}
+	}
+}
+
+template <class... Components>
+template <class Func>
+inline void EntityQuery<Components...>::ParallelForEach(Func&& func)
+{
+	Refresh();
+
+	work.Clear();
+
+	for (U32 archetypeIndex : matches)
+	{
+		const Archetype& archetype = Entities::archetypes[archetypeIndex];
+
+		for (U32 chunk = 0, remaining = archetype.count; remaining; ++chunk)
+		{
+			U32 count = Math::Min(remaining, archetype.capacity);
+			work.Push({ archetypeIndex, chunk, count });
+			remaining -= count;
+		}
+	}
+
+	if (!work.Size()) { return; }
+
+	EntityChunkRef* refs = work.Data();
+	auto* function = &func;
+
+	Jobs::Dispatch((U32)work.Size(), 1, [refs, function](JobDispatchArgs args) { RunChunk(refs[args.jobIndex], *function); });
+	Jobs::Wait();
+}
+
+template <class... Components>
+inline U32 EntityQuery<Components...>::Count()
+{
+	Refresh();
+
+	U32 count = 0;
+	for (U32 archetypeIndex : matches) { count += Entities::archetypes[archetypeIndex].count; }
+
+	return count;
+}
+
+template <class... Components>
+inline void EntityQuery<Components...>::Destroy()
+{
+	matches.Destroy();
+	work.Destroy();
+	checkedCount = 0;
+}
+
+template <class... Components>
+inline void EntityQuery<Components...>::Refresh()
+{
+	U64 mask = Entities::ComponentMask<Components...>();
+
+	for (; checkedCount < Entities::archetypeCount; ++checkedCount)
+	{
+		if ((Entities::archetypes[checkedCount].mask & mask) == mask) { matches.Push(checkedCount); }
+	}
+}
+
+template <class... Components>
+template <class Func>
+inline void EntityQuery<Components...>::RunChunk(const EntityChunkRef& ref, Func& func)
+{
+	const Archetype& archetype = Entities::archetypes[ref.archetype];
+	U8* chunk = archetype.chunks[ref.chunk];
+
+	RunColumns(Entities::EntityColumn(archetype, ref.chunk), ref.count, func, (Components*)(chunk + archetype.offsets[Entities::ComponentId<Components>()])...);
+}
+
+template <class... Components>
+template <class Func>
+inline void EntityQuery<Components...>::RunColumns(const Entity* entities, U32 count, Func& func, Components*... columns)
+{
+	for (U32 i = 0; i < count; ++i) { func(entities[i], columns[i]...); }
+}
\ No newline at end of file
@@ -0,0 +1,195 @@
+#include "Exploration.hpp"
+
+#include "Memory\Memory.hpp"
+
+#include "World.hpp"
+
+U64* Exploration::masks{ nullptr };
+U64* Exploration::anyMasks{ nullptr };
+U64* Exploration::fullMasks{ nullptr };
+
+static void Append(Vector<U8>& data, const void* value, U64 size)
+{
+	U64 offset = data.Size();
+	U64 needed = offset + size;
+
+	if (needed > data.Capacity()) { data.Reserve(Math::Max(needed, data.Capacity() * 2)); }
+	data.Resize(needed);
+
+	Memory::Copy(data.Data() + offset, value, size);
+}
+
+void Exploration::Initialize()
+{
+	Memory::AllocateStaticArray(&masks, TOTAL_CHUNK_COUNT);
+	Memory::AllocateStaticArray(&anyMasks, TOTAL_CHUNK_COUNT / 64 + 1);
+	Memory::AllocateStaticArray(&fullMasks, TOTAL_CHUNK_COUNT / 64 + 1);
+}
+
+void Exploration::Reset()
+{
+	Memory::Zero(masks, sizeof(U64) * TOTAL_CHUNK_COUNT);
+	Memory::Zero(anyMasks, sizeof(U64) * (TOTAL_CHUNK_COUNT / 64 + 1));
+	Memory::Zero(fullMasks, sizeof(U64) * (TOTAL_CHUNK_COUNT / 64 + 1));
+}
+
+void Exploration::Reveal(I32 centerX, I32 centerY, I32 radius)
+{
+	const I32 bottom = Math::Max(centerY - radius, 0);
+	const I32 top = Math::Min(centerY + radius, World::TILE_COUNT_Y - 1);
+	const I32 radiusSquared = radius * radius;
+
+	for (I32 y = bottom; y <= top; ++y)
+	{
+		I32 dy = y - centerY;
+		I32 dx = (I32)Math::Sqrt((F32)(radiusSquared - dy * dy));
+		I32 left = Math::Max(centerX - dx, 0);
+		I32 right = Math::Min(centerX + dx, World::TILE_COUNT_X - 1);
+
+		if (left > right) { continue; }
+
+		const U32 shift = (U32)(y & CHUNK_MASK) << CHUNK_SHIFT;
+		const U32 rowStart = (U32)(y >> CHUNK_SHIFT) * World::CHUNK_COUNT_X;
+
+		//The row's span split into one byte per chunk, only the end chunks are partial
+		for (I32 chunkX = left >> CHUNK_SHIFT; chunkX <= right >> CHUNK_SHIFT; ++chunkX)
+		{
+			U32 chunkIndex = rowStart + chunkX;
+			if (fullMasks[chunkIndex >> 6] & (1ull << (chunkIndex & 63))) { continue; }
+
+			I32 first = Math::Max(left - (chunkX << CHUNK_SHIFT), 0);
+			I32 last = Math::Min(right - (chunkX << CHUNK_SHIFT), (I32)CHUNK_MASK);
+			U64 row = (0xFFull >> (CHUNK_MASK - last)) & (0xFFull << first);
+
+			U64 previous = masks[chunkIndex];
+			masks[chunkIndex] |= row << shift;
+
+			if (masks[chunkIndex] != previous) { UpdateSummary(chunkIndex); }
+		}
+	}
+}
+
+bool Exploration::Explored(I32 x, I32 y)
+{
+	if (x < 0 || x >= World::TILE_COUNT_X || y < 0 || y >= World::TILE_COUNT_Y) { return false; }
+
+	return masks[(x >> CHUNK_SHIFT) + (y >> CHUNK_SHIFT) * World::CHUNK_COUNT_X] & ChunkBit(x, y);
+}
+
+U64 Exploration::ChunkMask(U32 chunkIndex)
+{
+	return masks[chunkIndex];
+}
+
+bool Exploration::AnyExplored(U32 chunkIndex)
+{
+	return anyMasks[chunkIndex >> 6] & (1ull << (chunkIndex & 63));
+}
+
+bool Exploration::FullyExplored(U32 chunkIndex)
+{
+	return fullMasks[chunkIndex >> 6] & (1ull << (chunkIndex & 63));
+}
+
+U64 Exploration::ExploredCount()
+{
+	const U32 chunkCount = (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y;
+	U64 count = 0;
+
+	//Full chunks are counted from the summary, only partial ones need their masks
+	for (U32 word = 0; word < (chunkCount + 63) / 64; ++word)
+	{
+		count += BitCount(fullMasks[word]) * CHUNK_TILE_COUNT;
+
+		for (U64 partial = anyMasks[word] & ~fullMasks[word]; partial; partial &= partial - 1)
+		{
+			count += BitCount(masks[word * 64 + FirstSetBit(partial)]);
+		}
+	}
+
+	return count;
+}
+
+void Exploration::Serialize(Vector<U8>& data)
+{
+	const U32 chunkCount = (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y;
+	Append(data, &chunkCount, sizeof(U32));
+
+	for (U32 i = 0; i < chunkCount;)
+	{
+		U64 mask = masks[i];
+		U32 type = mask == 0 ? EXPLORE_RUN_ZERO : mask == U64_MAX ? EXPLORE_RUN_FULL : EXPLORE_RUN_LITERAL;
+		U32 end = i + 1;
+
+		if (type == EXPLORE_RUN_LITERAL)
+		{
+			while (end < chunkCount && masks[end] != 0 && masks[end] != U64_MAX) { ++end; }
+		}
+		else
+		{
+			while (end < chunkCount && masks[end] == mask) { ++end; }
+		}
+
+		U32 token = (type << EXPLORE_RUN_SHIFT) | (end - i);
+		Append(data, &token, sizeof(U32));
+
+		if (type == EXPLORE_RUN_LITERAL) { Append(data, masks + i, sizeof(U64) * (end - i)); }
+
+		i = end;
+	}
+}
+
+bool Exploration::Deserialize(const U8* data, U64 size)
+{
+	const U32 chunkCount = (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y;
+	U32 storedCount;
+
+	if (size < sizeof(U32)) { return false; }
+	Memory::Copy(&storedCount, data, sizeof(U32));
+	if (storedCount != chunkCount) { return false; }
+
+	Reset();
+
+	U64 offset = sizeof(U32);
+
+	for (U32 i = 0; i < chunkCount;)
+	{
+		U32 token;
+
+		if (offset + sizeof(U32) > size) { Reset(); return false; }
+		Memory::Copy(&token, data + offset, sizeof(U32));
+		offset += sizeof(U32);
+
+		U32 type = token >> EXPLORE_RUN_SHIFT;
+		U32 count = token & ((1u << EXPLORE_RUN_SHIFT) - 1);
+
+		if (count == 0 || count > chunkCount - i || type > EXPLORE_RUN_LITERAL) { Reset(); return false; }
+
+		if (type == EXPLORE_RUN_LITERAL)
+		{
+			if (offset + sizeof(U64) * count > size) { Reset(); return false; }
+
+			Memory::Copy(masks + i, data + offset, sizeof(U64) * count);
+			offset += sizeof(U64) * count;
+		}
+		else if (type == EXPLORE_RUN_FULL)
+		{
+			Memory::Set(masks + i, U8_MAX, sizeof(U64) * count);
+		}
+
+		for (U32 end = i + count; i < end; ++i) { UpdateSummary(i); }
+	}
+
+	return true;
+}
+
+void Exploration::UpdateSummary(U32 chunkIndex)
+{
+	U64 bit = 1ull << (chunkIndex & 63);
+
+	if (masks[chunkIndex]) { anyMasks[chunkIndex >> 6] |= bit; }
+	else { anyMasks[chunkIndex >> 6] &= ~bit; }
+
+	if (masks[chunkIndex] == U64_MAX) { fullMasks[chunkIndex >> 6] |= bit; }
+	else { fullMasks[chunkIndex >> 6] &= ~bit; }
+}
\ No newline at end of file
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+constexpr I32 EXPLORE_RADIUS = 40; //Tiles revealed around the view's center
+constexpr U32 EXPLORE_RUN_ZERO = 0; //Serialized run types, stored in the top two bits of a U32 with the word count under them
+constexpr U32 EXPLORE_RUN_FULL = 1;
+constexpr U32 EXPLORE_RUN_LITERAL = 2;
+constexpr U32 EXPLORE_RUN_SHIFT = 30;
+
+/*
+* Which tiles the map has seen, one bit per tile in a 64-bit mask per chunk laid out like ChunkBit
+*
+* Two summary bitsets hold one bit per chunk, set once any of it or all of it is explored. Reveal skips chunks that are
+* already full and whole-chunk questions never read the masks. Circles are revealed a tile row at a time, each row's
+* span becomes a byte mask ORed into every chunk it crosses
+*
+* Serialize stores chunk masks in order as runs of empty words, runs of full words and runs of literal words, so a few
+* large explored regions take a handful of runs
+*/
+class Exploration
+{
+public:
+	static void Reveal(I32 centerX, I32 centerY, I32 radius); //Tile coordinates
+	static bool Explored(I32 x, I32 y);
+	static U64 ChunkMask(U32 chunkIndex);
+	static bool AnyExplored(U32 chunkIndex);
+	static bool FullyExplored(U32 chunkIndex);
+	static U64 ExploredCount();
+
+	static void Serialize(Vector<U8>& data);
+	static bool Deserialize(const U8* data, U64 size);
+
+private:
+	static void Initialize();
+	static void Reset();
+	static void UpdateSummary(U32 chunkIndex);
+
+	static U64* masks;
+	static U64* anyMasks;
+	static U64* fullMasks;
+
+	STATIC_CLASS(Exploration);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
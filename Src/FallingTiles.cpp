@@ -0,0 +1,211 @@
+#include "FallingTiles.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Platform\Jobs.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "TileRegistry.hpp"
+
+bool FallingTiles::falls[U8_MAX + 1]{};
+
+U64* FallingTiles::solidBits{ nullptr };
+U64* FallingTiles::fallingBits{ nullptr };
+U16* FallingTiles::columnLows{ nullptr };
+Vector<U32> FallingTiles::pending;
+Vector<U32> FallingTiles::active;
+U64 FallingTiles::tilesMoved{ 0 };
+
+//Lowest set bit of a column at or above y, -1 if there's none
+static I32 NextSet(const U64* column, I32 y)
+{
+	I32 word = y >> 6;
+	U64 bits = column[word] & (U64_MAX << (y & 63));
+
+	while (!bits)
+	{
+		if (++word == (I32)FALLING_COLUMN_WORDS) { return -1; }
+		bits = column[word];
+	}
+
+	return (word << 6) + (I32)FirstSetBit(bits);
+}
+
+//Lowest clear bit of a column at or above y
+static I32 NextClear(const U64* column, I32 y)
+{
+	I32 word = y >> 6;
+	U64 bits = ~column[word] & (U64_MAX << (y & 63));
+
+	while (!bits)
+	{
+		if (++word == (I32)FALLING_COLUMN_WORDS) { return word << 6; }
+		bits = ~column[word];
+	}
+
+	return (word << 6) + (I32)FirstSetBit(bits);
+}
+
+//Highest set bit of a column at or below y, -1 if there's none
+static I32 PreviousSet(const U64* column, I32 y)
+{
+	if (y < 0) { return -1; }
+
+	I32 word = y >> 6;
+	U64 bits = column[word] & (U64_MAX >> (63 - (y & 63)));
+
+	while (!bits)
+	{
+		if (--word < 0) { return -1; }
+		bits = column[word];
+	}
+
+	return (word << 6) + (I32)LastSetBit(bits);
+}
+
+void FallingTiles::Initialize()
+{
+	Memory::AllocateStaticArray(&solidBits, (U64)WORLD_SIZE_LARGE * FALLING_COLUMN_WORDS);
+	Memory::AllocateStaticArray(&fallingBits, (U64)WORLD_SIZE_LARGE * FALLING_COLUMN_WORDS);
+	Memory::AllocateStaticArray(&columnLows, (U64)WORLD_SIZE_LARGE);
+	Memory::Copy(falls, BLOCKS.falls, sizeof(falls));
+
+	Reset();
+}
+
+void FallingTiles::Shutdown()
+{
+	pending.Destroy();
+	active.Destroy();
+}
+
+void FallingTiles::Reset()
+{
+	Memory::Set(columnLows, U8_MAX, sizeof(U16) * WORLD_SIZE_LARGE);
+	pending.Clear();
+	active.Clear();
+}
+
+void FallingTiles::Build()
+{
+	Jobs::Dispatch(World::TILE_COUNT_X, 64, [](JobDispatchArgs args) {
+		const U32 x = args.jobIndex;
+		U64* solid = solidBits + x * FALLING_COLUMN_WORDS;
+		U64* falling = fallingBits + x * FALLING_COLUMN_WORDS;
+
+		Memory::Zero(solid, sizeof(U64) * FALLING_COLUMN_WORDS);
+		Memory::Zero(falling, sizeof(U64) * FALLING_COLUMN_WORDS);
+
+		const Tile* tile = World::tiles + x;
+
+		for (I32 y = 0; y < World::TILE_COUNT_Y; ++y, tile += World::TILE_COUNT_X)
+		{
+			if (BLOCKS.solid[tile->block]) { solid[y >> 6] |= 1ull << (y & 63); }
+			if (falls[tile->block]) { falling[y >> 6] |= 1ull << (y & 63); }
+		}
+	});
+
+	Jobs::Wait();
+}
+
+void FallingTiles::Update()
+{
+	Swap(pending, active);
+	pending.Clear();
+
+	for (U32 x : active)
+	{
+		U32 low = columnLows[x];
+		columnLows[x] = U16_MAX;
+
+		FallColumn(x, low);
+	}
+}
+
+void FallingTiles::Disturb(U32 index, U8 block)
+{
+	const U32 x = index % World::TILE_COUNT_X;
+	const U32 y = index / World::TILE_COUNT_X;
+	const U64 bit = 1ull << (y & 63);
+	const U64 word = x * FALLING_COLUMN_WORDS + (y >> 6);
+
+	if (BLOCKS.solid[block]) { solidBits[word] |= bit; }
+	else { solidBits[word] &= ~bit; }
+
+	if (falls[block]) { fallingBits[word] |= bit; }
+	else { fallingBits[word] &= ~bit; }
+
+	Queue(x, y);
+}
+
+void FallingTiles::Queue(U32 x, U32 y)
+{
+	if (columnLows[x] == U16_MAX) { pending.Push(x); }
+
+	columnLows[x] = Math::Min(columnLows[x], (U16)y);
+}
+
+void FallingTiles::FallColumn(U32 x, U32 low)
+{
+	const U64* solid = solidBits + x * FALLING_COLUMN_WORDS;
+	const U64* falling = fallingBits + x * FALLING_COLUMN_WORDS;
+
+	//Runs are handled bottom up, so a run always sees the space the one under it just left
+	for (I32 bottom = NextSet(falling, low); bottom >= 0 && bottom < World::TILE_COUNT_Y;)
+	{
+		I32 top = NextClear(falling, bottom) - 1;
+		I32 gap = bottom - PreviousSet(solid, bottom - 1) - 1;
+
+		if (gap) { MoveRun(x, bottom, top, Math::Min(gap, FALLING_SPEED)); }
+
+		bottom = NextSet(falling, top + 1);
+	}
+}
+
+void FallingTiles::MoveRun(U32 x, I32 bottom, I32 top, I32 distance)
+{
+	const U32 width = World::TILE_COUNT_X;
+	const I32 length = top - bottom + 1;
+
+	//Liquid under the run swaps places with it
+	U8 liquid[FALLING_SPEED];
+	for (I32 i = 0; i < distance; ++i) { liquid[i] = World::tiles[x + (bottom - distance + i) * width].liquidAmt; }
+
+	for (I32 y = bottom - distance; y <= top; ++y)
+	{
+		const U32 index = x + y * width;
+		Tile tile = World::tiles[index];
+
+		if (y + distance <= top)
+		{
+			const Tile& source = World::tiles[index + distance * width];
+			tile.block = source.block;
+			tile.decoration = source.decoration;
+			tile.liquidAmt = 0;
+		}
+		else
+		{
+			tile.block = U8_MAX;
+			tile.decoration = U8_MAX;
+			tile.liquidAmt = liquid[y - (bottom - distance) - length];
+		}
+
+		const Tile& current = World::tiles[index];
+
+		if (tile.block != current.block || tile.decoration != current.decoration || tile.liquidAmt != current.liquidAmt)
+		{
+			World::ReplaceTile(index, tile);
+			++tilesMoved;
+		}
+	}
+}
+
+U32 FallingTiles::ActiveColumnCount()
+{
+	return (U32)pending.Size();
+}
+
+U64 FallingTiles::TilesMoved()
+{
+	return tilesMoved;
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+constexpr U32 FALLING_COLUMN_WORDS = (U32)(TOTAL_TILE_COUNT / WORLD_SIZE_LARGE / 64 + 1); //64 tiles of a column per word
+constexpr I32 FALLING_SPEED = 2; //Tiles a run falls per tick
+
+/*
+* Gravity for blocks like sand and gravel, falls starts as the registry's flags for each block id
+*
+* Every column keeps two bitsets of its own tiles, bottom to top: solid tiles and falling ones, so walking a column is
+* a few bit scans over contiguous words instead of a strided walk through the tile array. World::ReplaceTile keeps
+* them current and queues the column with the lowest tile that changed
+*
+* A queued column is scanned upward from that tile. Each run of falling blocks with air under it moves down as a
+* whole, only the tiles whose contents change are written. Liquid in the way is carried up into the space the run
+* left. Moving a run edits its column again, so it stays queued until every run in it has landed
+*/
+class FallingTiles
+{
+public:
+	static U32 ActiveColumnCount();
+	static U64 TilesMoved();
+
+	static bool falls[U8_MAX + 1];
+
+private:
+	static void Initialize();
+	static void Shutdown();
+	static void Reset();
+	static void Build();
+
+	static void Update();
+	static void Disturb(U32 index, U8 block);
+	static void Queue(U32 x, U32 y);
+	static void FallColumn(U32 x, U32 low);
+	static void MoveRun(U32 x, I32 bottom, I32 top, I32 distance);
+
+	static U64* solidBits;
+	static U64* fallingBits;
+	static U16* columnLows;
+	static Vector<U32> pending;
+	static Vector<U32> active;
+	static U64 tilesMoved;
+
+	STATIC_CLASS(FallingTiles);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
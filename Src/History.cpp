@@ -0,0 +1,342 @@
+#include "History.hpp"
+
+#include "Core\Time.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "Liquid.hpp"
+#include "Snapshots.hpp"
+
+HistoryBlock History::blocks[HISTORY_MAX_BLOCKS];
+U32 History::firstBlock{ 0 };
+U32 History::blockCount{ 0 };
+U64 History::firstTick{ 0 };
+U64 History::recordCount{ 0 };
+U64 History::editCount{ 0 };
+
+Vector<TileDelta> History::pending;
+Vector<TileDelta> History::scratch;
+bool History::applying{ false };
+F64 History::lastSeekTime{ 0.0 };
+
+static void WriteVarint(U8*& data, U32 value)
+{
+	while (value >= 0x80)
+	{
+		*data++ = (U8)(value | 0x80);
+		value >>= 7;
+	}
+
+	*data++ = (U8)value;
+}
+
+static U32 ReadVarint(const U8*& data)
+{
+	U32 value = 0;
+	U32 shift = 0;
+
+	while (*data & 0x80)
+	{
+		value |= (U32)(*data++ & 0x7F) << shift;
+		shift += 7;
+	}
+
+	return value | ((U32)*data++ << shift);
+}
+
+void History::Shutdown()
+{
+	for (HistoryBlock& block : blocks) { block.data.Destroy(); }
+
+	pending.Destroy();
+	scratch.Destroy();
+}
+
+void History::Reset()
+{
+	for (U32 i = 0; i < blockCount; ++i) { blocks[(firstBlock + i) % HISTORY_MAX_BLOCKS].data.Clear(); }
+
+	firstBlock = 0;
+	blockCount = 0;
+	firstTick = World::tick;
+	recordCount = 0;
+	editCount = 0;
+	pending.Clear();
+}
+
+void History::Truncate(U64 tick)
+{
+	//Snapshots past the cut are keyframes of the dropped ticks
+	Snapshots::TruncateAfter(tick);
+
+	if (tick < firstTick || tick > LastTick())
+	{
+		Reset();
+		firstTick = tick;
+		return;
+	}
+
+	U64 keep = tick - firstTick;
+
+	//Edit counts of the dropped records are read back from their headers
+	for (U64 record = keep; record < recordCount; ++record)
+	{
+		HistoryBlock& block = BlockForRecord(record);
+		const U8* data = block.data.Data() + block.tickOffsets[record % HISTORY_BLOCK_TICKS];
+		U32 count = ReadVarint(data);
+
+		block.editCount -= count;
+		editCount -= count;
+	}
+
+	if (keep % HISTORY_BLOCK_TICKS)
+	{
+		HistoryBlock& block = BlockForRecord(keep);
+		block.data.Resize(block.tickOffsets[keep % HISTORY_BLOCK_TICKS]);
+	}
+
+	U32 keepBlocks = (U32)((keep + HISTORY_BLOCK_TICKS - 1) / HISTORY_BLOCK_TICKS);
+
+	for (U32 i = keepBlocks; i < blockCount; ++i) { blocks[(firstBlock + i) % HISTORY_MAX_BLOCKS].data.Clear(); }
+
+	blockCount = keepBlocks;
+	recordCount = keep;
+}
+
+void History::Record(U32 index, U8 layer, U8 from, U8 to)
+{
+	if (!applying) { pending.Push({ index, layer, from, to }); }
+}
+
+void History::Record(U32 index, const Tile& previous, const Tile& tile)
+{
+	if (applying) { return; }
+
+	for (U8 layer = TILE_LAYER_WALL; layer <= TILE_LAYER_LIQUID; ++layer)
+	{
+		if (previous[layer] != tile[layer]) { pending.Push({ index, layer, previous[layer], tile[layer] }); }
+	}
+}
+
+void History::Record(const Vector<TileDelta>& deltas)
+{
+	if (!applying && deltas.Size()) { pending.Merge(deltas); }
+}
+
+void History::EndTick()
+{
+	//Ticking from anywhere but the end of the log starts a new timeline
+	if (World::tick - 1 != LastTick()) { Truncate(World::tick - 1); }
+
+	if (recordCount % HISTORY_BLOCK_TICKS == 0)
+	{
+		if (blockCount == HISTORY_MAX_BLOCKS)
+		{
+			HistoryBlock& oldest = blocks[firstBlock];
+			editCount -= oldest.editCount;
+			oldest.data.Clear();
+
+			firstBlock = (firstBlock + 1) % HISTORY_MAX_BLOCKS;
+			--blockCount;
+			firstTick += HISTORY_BLOCK_TICKS;
+			recordCount -= HISTORY_BLOCK_TICKS;
+		}
+
+		HistoryBlock& block = blocks[(firstBlock + blockCount) % HISTORY_MAX_BLOCKS];
+		block.data.Clear();
+		block.editCount = 0;
+		++blockCount;
+	}
+
+	HistoryBlock& block = BlockForRecord(recordCount);
+	block.tickOffsets[recordCount % HISTORY_BLOCK_TICKS] = (U32)block.data.Size();
+	block.editCount += pending.Size();
+	editCount += pending.Size();
+
+	Encode(pending, block.data);
+
+	pending.Clear();
+	++recordCount;
+}
+
+bool History::StepForward()
+{
+	DiscardPending();
+
+	if (World::tick < firstTick || World::tick >= LastTick()) { return false; }
+
+	DecodeRecord(World::tick - firstTick, scratch);
+
+	applying = true;
+	for (const TileDelta& delta : scratch) { Apply(delta, true); }
+	applying = false;
+
+	++World::tick;
+	return true;
+}
+
+bool History::StepBackward()
+{
+	DiscardPending();
+
+	if (World::tick <= firstTick || World::tick > LastTick()) { return false; }
+
+	DecodeRecord(World::tick - 1 - firstTick, scratch);
+
+	applying = true;
+	for (U64 i = scratch.Size(); i > 0; --i) { Apply(scratch[i - 1], false); }
+	applying = false;
+
+	--World::tick;
+	return true;
+}
+
+bool History::Seek(U64 tick)
+{
+	if (tick < firstTick || tick > LastTick()) { return false; }
+
+	Timer timer;
+	timer.Start();
+
+	DiscardPending();
+
+	U64 distance = World::tick > tick ? World::tick - tick : tick - World::tick;
+
+	//Snapshots are the keyframes, jump to the closest one before the target when replaying from it is shorter
+	U32 keyframe = U32_MAX;
+	U64 keyframeTick = 0;
+
+	for (U32 age = 0; age < Snapshots::Count(); ++age)
+	{
+		U64 snapshotTick = Snapshots::SnapshotTick(age);
+
+		if (snapshotTick >= firstTick && snapshotTick <= tick && (keyframe == U32_MAX || snapshotTick > keyframeTick))
+		{
+			keyframe = age;
+			keyframeTick = snapshotTick;
+		}
+	}
+
+	if (keyframe != U32_MAX && tick - keyframeTick < distance) { Snapshots::Restore(keyframe); }
+
+	while (World::tick < tick && StepForward()) {}
+	while (World::tick > tick && StepBackward()) {}
+
+	lastSeekTime = timer.CurrentTime();
+
+	return World::tick == tick;
+}
+
+U64 History::FirstTick()
+{
+	return firstTick;
+}
+
+U64 History::LastTick()
+{
+	return firstTick + recordCount;
+}
+
+U64 History::EditCount()
+{
+	return editCount;
+}
+
+U64 History::MemoryUsed()
+{
+	U64 memory = sizeof(U32) * HISTORY_BLOCK_TICKS * blockCount;
+
+	for (U32 i = 0; i < blockCount; ++i) { memory += blocks[(firstBlock + i) % HISTORY_MAX_BLOCKS].data.Size(); }
+
+	return memory;
+}
+
+F64 History::LastSeekTime()
+{
+	return lastSeekTime;
+}
+
+void History::DiscardPending()
+{
+	//Edits since the last tick aren't in the log, undo them so the world matches a record boundary again
+	applying = true;
+	for (U64 i = pending.Size(); i > 0; --i) { Apply(pending[i - 1], false); }
+	applying = false;
+
+	pending.Clear();
+}
+
+HistoryBlock& History::BlockForRecord(U64 record)
+{
+	return blocks[(firstBlock + record / HISTORY_BLOCK_TICKS) % HISTORY_MAX_BLOCKS];
+}
+
+void History::Encode(const Vector<TileDelta>& deltas, Vector<U8>& data)
+{
+	//Worst case is a 5 byte count plus a 4 byte varint and 2 values per edit
+	U64 start = data.Size();
+	U64 worst = start + 5 + deltas.Size() * 6;
+	if (worst > data.Capacity()) { data.Reserve(Math::Max(worst, data.Capacity() * 2)); }
+
+	data.Resize(worst);
+	U8* write = data.Data() + start;
+
+	WriteVarint(write, (U32)deltas.Size());
+
+	U32 previous = 0;
+
+	for (const TileDelta& delta : deltas)
+	{
+		I32 difference = (I32)(delta.index - previous);
+		U32 zigzag = ((U32)difference << 1) ^ (U32)(difference >> 31);
+
+		WriteVarint(write, (zigzag << 2) | delta.layer);
+		*write++ = delta.from;
+		*write++ = delta.to;
+
+		previous = delta.index;
+	}
+
+	data.Resize(write - data.Data());
+}
+
+void History::DecodeRecord(U64 record, Vector<TileDelta>& deltas)
+{
+	const HistoryBlock& block = BlockForRecord(record);
+	const U8* data = block.data.Data() + block.tickOffsets[record % HISTORY_BLOCK_TICKS];
+
+	deltas.Resize(ReadVarint(data));
+
+	U32 index = 0;
+
+	for (TileDelta& delta : deltas)
+	{
+		U32 value = ReadVarint(data);
+		U32 zigzag = value >> 2;
+
+		index += (U32)((I32)(zigzag >> 1) ^ -(I32)(zigzag & 1));
+
+		delta.index = index;
+		delta.layer = (U8)(value & 3);
+		delta.from = *data++;
+		delta.to = *data++;
+	}
+}
+
+void History::Apply(const TileDelta& delta, bool forward)
+{
+	U8 value = forward ? delta.to : delta.from;
+
+	if (delta.layer == TILE_LAYER_LIQUID)
+	{
+		World::tiles[delta.index].liquidAmt = value;
+		World::DirtyTile(delta.index);
+		Liquid::Wake(delta.index);
+	}
+	else
+	{
+		Tile tile = World::tiles[delta.index];
+		tile[delta.layer] = value;
+		World::ReplaceTile(delta.index, tile);
+	}
+}
\ No newline at end of file
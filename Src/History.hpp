@@ -0,0 +1,89 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+struct Tile;
+
+constexpr U32 HISTORY_BLOCK_TICKS = 256;
+constexpr U32 HISTORY_MAX_BLOCKS = 256; //About half an hour at TICK_TIME
+
+/// <summary>
+/// One layer of one tile changing from one value to another
+/// </summary>
+struct TileDelta
+{
+	U32 index;
+	U8 layer;
+	U8 from;
+	U8 to;
+};
+
+/// <summary>
+/// HISTORY_BLOCK_TICKS consecutive ticks of compressed deltas, tickOffsets is where each tick starts in data
+/// </summary>
+struct HistoryBlock
+{
+	Vector<U8> data;
+	U32 tickOffsets[HISTORY_BLOCK_TICKS];
+	U64 editCount;
+};
+
+/*
+* Log of every tile edit, used to scrub through time a tick at a time
+*
+* Record i takes the world from tick FirstTick() + i to the next one. Edits are gathered while a tick runs then
+* packed as a varint count followed by, per edit, a varint of the zigzagged index delta from the previous edit
+* shifted over the layer, then the old and new values. Neighbouring edits take 3-4 bytes instead of sizeof(TileDelta)
+*
+* Playing backward applies a tick's old values in reverse order. Long seeks jump to the closest Snapshots entry
+* first, snapshots are the log's keyframes, so a seek replays at most SNAPSHOT_INTERVAL ticks
+*/
+class History
+{
+public:
+	static bool StepForward();
+	static bool StepBackward();
+	static bool Seek(U64 tick);
+
+	static U64 FirstTick();
+	static U64 LastTick();
+	static U64 EditCount();
+	static U64 MemoryUsed();
+	static F64 LastSeekTime();
+
+private:
+	static void Shutdown();
+	static void Reset();
+	static void Truncate(U64 tick);
+
+	static void Record(U32 index, U8 layer, U8 from, U8 to);
+	static void Record(U32 index, const Tile& previous, const Tile& tile);
+	static void Record(const Vector<TileDelta>& deltas);
+	static void EndTick();
+	static void DiscardPending();
+
+	static HistoryBlock& BlockForRecord(U64 record);
+	static void Encode(const Vector<TileDelta>& deltas, Vector<U8>& data);
+	static void DecodeRecord(U64 record, Vector<TileDelta>& deltas);
+	static void Apply(const TileDelta& delta, bool forward);
+
+	static HistoryBlock blocks[HISTORY_MAX_BLOCKS];
+	static U32 firstBlock;
+	static U32 blockCount;
+	static U64 firstTick;
+	static U64 recordCount;
+	static U64 editCount;
+
+	static Vector<TileDelta> pending;
+	static Vector<TileDelta> scratch;
+	static bool applying;
+	static F64 lastSeekTime;
+
+	STATIC_CLASS(History);
+	friend class World;
+	friend class Liquid;
+	friend class Snapshots;
+	friend class Benchmarks;
+};
\ No newline at end of file
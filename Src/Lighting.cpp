@@ -0,0 +1,389 @@
+#include "Lighting.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Platform\Jobs.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "TileRegistry.hpp"
+
+U8* Lighting::light{ nullptr };
+U16* Lighting::skyHeights{ nullptr };
+U64* Lighting::sourceMasks{ nullptr };
+Vector<LightSource> Lighting::sources;
+
+Vector<LightNode> Lighting::stripQueues[LIGHT_MAX_STRIPS];
+Vector<LightNode> Lighting::sunQueue;
+Vector<LightNode> Lighting::blockQueue;
+Vector<LightRemoval> Lighting::sunRemovals;
+Vector<LightRemoval> Lighting::blockRemovals;
+
+void Lighting::Initialize()
+{
+	Memory::AllocateStaticArray(&light, TOTAL_TILE_COUNT);
+	Memory::AllocateStaticArray(&skyHeights, (U64)WORLD_SIZE_LARGE);
+	Memory::AllocateStaticArray(&sourceMasks, TOTAL_CHUNK_COUNT);
+
+	sunQueue.Reserve(1024);
+	blockQueue.Reserve(1024);
+	sunRemovals.Reserve(1024);
+	blockRemovals.Reserve(1024);
+
+	Reset();
+}
+
+void Lighting::Shutdown()
+{
+	sources.Destroy();
+	sunQueue.Destroy();
+	blockQueue.Destroy();
+	sunRemovals.Destroy();
+	blockRemovals.Destroy();
+
+	for (Vector<LightNode>& queue : stripQueues) { queue.Destroy(); }
+}
+
+void Lighting::Reset()
+{
+	Memory::Zero(sourceMasks, sizeof(U64) * TOTAL_CHUNK_COUNT);
+	sources.Clear();
+}
+
+void Lighting::AddSource(U32 index, U8 level)
+{
+	const U16 width = World::TILE_COUNT_X;
+	U16 x = index % width;
+	U16 y = index / width;
+
+	if (IsSource(x, y)) { RemoveSource(index); }
+
+	sourceMasks[(x >> CHUNK_SHIFT) + (y >> CHUNK_SHIFT) * World::CHUNK_COUNT_X] |= ChunkBit(x, y);
+	sources.Push({ index, level });
+
+	if (Level(index, LIGHT_BLOCK_SHIFT) < level)
+	{
+		SetLevel(index, LIGHT_BLOCK_SHIFT, level);
+		World::DirtyTileRender(index);
+		blockQueue.Push({ x, y });
+		Propagate(blockQueue, LIGHT_BLOCK_SHIFT, true);
+	}
+}
+
+void Lighting::RemoveSource(U32 index)
+{
+	const U16 width = World::TILE_COUNT_X;
+	U16 x = index % width;
+	U16 y = index / width;
+
+	if (!IsSource(x, y)) { return; }
+
+	sourceMasks[(x >> CHUNK_SHIFT) + (y >> CHUNK_SHIFT) * World::CHUNK_COUNT_X] &= ~ChunkBit(x, y);
+
+	for (U64 i = 0; i < sources.Size(); ++i)
+	{
+		if (sources[i].index == index) { sources.RemoveSwap(i); break; }
+	}
+
+	Remove(x, y, blockRemovals, LIGHT_BLOCK_SHIFT);
+	Unpropagate(blockRemovals, blockQueue, LIGHT_BLOCK_SHIFT);
+	Propagate(blockQueue, LIGHT_BLOCK_SHIFT, true);
+}
+
+U8 Lighting::SunLight(U32 index)
+{
+	return Level(index, LIGHT_SUN_SHIFT);
+}
+
+U8 Lighting::BlockLight(U32 index)
+{
+	return Level(index, LIGHT_BLOCK_SHIFT);
+}
+
+F32 Lighting::Brightness(U32 index)
+{
+	U8 level = Math::Max(Level(index, LIGHT_SUN_SHIFT), Level(index, LIGHT_BLOCK_SHIFT));
+
+	return LIGHT_AMBIENT + (1.0f - LIGHT_AMBIENT) * level / (F32)LIGHT_MAX;
+}
+
+void Lighting::Relight()
+{
+	Memory::Zero(light, (U64)World::TILE_COUNT_X * World::TILE_COUNT_Y);
+
+	U32 stripCount = (World::CHUNK_COUNT_X + LIGHT_STRIP_CHUNKS - 1) / LIGHT_STRIP_CHUNKS;
+
+	//Every strip needs its neighbours' sky heights before flooding, so those are found in their own pass
+	Jobs::Dispatch(stripCount, 1, [](JobDispatchArgs args) { FindSkyHeights(args.jobIndex); });
+	Jobs::Wait();
+
+	//Same parity strips are far enough apart that their floods never write the same tile
+	for (U32 parity = 0; parity < 2; ++parity)
+	{
+		U32 jobCount = (stripCount + 1 - parity) / 2;
+
+		Jobs::Dispatch(jobCount, 1, [parity](JobDispatchArgs args) {
+			RelightStrip(args.jobIndex * 2 + parity, stripQueues[args.jobIndex]);
+		});
+
+		Jobs::Wait();
+	}
+
+	World::DirtyAll();
+}
+
+void Lighting::FindSkyHeights(U32 strip)
+{
+	const Tile* tiles = World::tiles;
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+	const I32 startX = strip * LIGHT_STRIP_CHUNKS * CHUNK_SIZE;
+	const I32 endX = Math::Min(startX + (I32)(LIGHT_STRIP_CHUNKS * CHUNK_SIZE), width);
+
+	for (I32 x = startX; x < endX; ++x)
+	{
+		I32 y = height;
+		while (y > 0 && !BlocksSky(tiles[x + (y - 1) * width])) { --y; }
+
+		skyHeights[x] = (U16)y;
+	}
+}
+
+void Lighting::RelightStrip(U32 strip, Vector<LightNode>& queue)
+{
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+	const I32 startX = strip * LIGHT_STRIP_CHUNKS * CHUNK_SIZE;
+	const I32 endX = Math::Min(startX + (I32)(LIGHT_STRIP_CHUNKS * CHUNK_SIZE), width);
+
+	for (I32 x = startX; x < endX; ++x)
+	{
+		I32 bottom = skyHeights[x];
+		I32 exposed = bottom;
+		if (x > 0) { exposed = Math::Max(exposed, (I32)skyHeights[x - 1]); }
+		if (x < width - 1) { exposed = Math::Max(exposed, (I32)skyHeights[x + 1]); }
+
+		//Only the bottom of a sky column and the part beside a shorter neighbour can spread anywhere
+		for (I32 y = bottom; y < height; ++y)
+		{
+			SetLevel(x + y * width, LIGHT_SUN_SHIFT, LIGHT_MAX);
+
+			if (y == bottom || y < exposed) { queue.Push({ (U16)x, (U16)y }); }
+		}
+	}
+
+	Propagate(queue, LIGHT_SUN_SHIFT, false);
+
+	for (const LightSource& source : sources)
+	{
+		I32 x = source.index % width;
+
+		if (x >= startX && x < endX && Level(source.index, LIGHT_BLOCK_SHIFT) < source.level)
+		{
+			SetLevel(source.index, LIGHT_BLOCK_SHIFT, source.level);
+			queue.Push({ (U16)x, (U16)(source.index / width) });
+		}
+	}
+
+	Propagate(queue, LIGHT_BLOCK_SHIFT, false);
+}
+
+void Lighting::TileChanged(U32 index, const Tile& previous)
+{
+	const Tile* tiles = World::tiles;
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+	const Tile& tile = tiles[index];
+
+	bool opaque = Opaque(tile);
+	bool wasOpaque = Opaque(previous);
+	bool blocksSky = BlocksSky(tile);
+	bool blockedSky = BlocksSky(previous);
+
+	if (opaque == wasOpaque && blocksSky == blockedSky) { return; }
+
+	I32 x = index % width;
+	I32 y = index / width;
+
+	if (blocksSky != blockedSky)
+	{
+		I32 bottom = skyHeights[x];
+
+		if (blocksSky && y >= bottom)
+		{
+			//Everything from here down to the old bottom of the column loses direct sunlight
+			for (I32 cy = bottom; cy <= y; ++cy) { Remove((U16)x, (U16)cy, sunRemovals, LIGHT_SUN_SHIFT); }
+
+			skyHeights[x] = (U16)(y + 1);
+		}
+		else if (!blocksSky && y + 1 == bottom)
+		{
+			I32 cy = y;
+			while (cy >= 0 && !BlocksSky(tiles[x + cy * width]))
+			{
+				U32 columnIndex = x + cy * width;
+				SetLevel(columnIndex, LIGHT_SUN_SHIFT, LIGHT_MAX);
+				World::DirtyTileRender(columnIndex);
+				sunQueue.Push({ (U16)x, (U16)cy });
+				--cy;
+			}
+
+			skyHeights[x] = (U16)(cy + 1);
+		}
+	}
+
+	if (opaque != wasOpaque)
+	{
+		if (opaque)
+		{
+			Remove((U16)x, (U16)y, sunRemovals, LIGHT_SUN_SHIFT);
+			Remove((U16)x, (U16)y, blockRemovals, LIGHT_BLOCK_SHIFT);
+		}
+		else
+		{
+			//Light can now pass through, so let the surrounding tiles flood back in
+			auto reseed = [&](I32 nx, I32 ny) {
+				if (nx < 0 || nx >= width || ny < 0 || ny >= height) { return; }
+
+				sunQueue.Push({ (U16)nx, (U16)ny });
+				blockQueue.Push({ (U16)nx, (U16)ny });
+			};
+
+			reseed(x, y);
+			reseed(x - 1, y);
+			reseed(x + 1, y);
+			reseed(x, y - 1);
+			reseed(x, y + 1);
+		}
+	}
+
+	Unpropagate(sunRemovals, sunQueue, LIGHT_SUN_SHIFT);
+	Propagate(sunQueue, LIGHT_SUN_SHIFT, true);
+	Unpropagate(blockRemovals, blockQueue, LIGHT_BLOCK_SHIFT);
+	Propagate(blockQueue, LIGHT_BLOCK_SHIFT, true);
+}
+
+void Lighting::Propagate(Vector<LightNode>& queue, U8 shift, bool markDirty)
+{
+	const Tile* tiles = World::tiles;
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+
+	//The queue is consumed front to back without popping, so a flood costs no more than its pushes
+	for (U64 head = 0; head < queue.Size(); ++head)
+	{
+		LightNode node = queue[head];
+		U32 index = node.x + node.y * width;
+		U8 level = Level(index, shift);
+
+		if (level <= 1) { continue; }
+		if (Opaque(tiles[index]) && !(shift == LIGHT_BLOCK_SHIFT && IsSource(node.x, node.y))) { continue; }
+
+		U8 next = level - 1;
+
+		auto spread = [&](I32 nx, I32 ny) {
+			U32 neighbor = nx + ny * width;
+
+			if (Level(neighbor, shift) < next)
+			{
+				SetLevel(neighbor, shift, next);
+				if (markDirty) { World::DirtyTileRender(neighbor); }
+				queue.Push({ (U16)nx, (U16)ny });
+			}
+		};
+
+		if (node.x > 0) { spread(node.x - 1, node.y); }
+		if (node.x < width - 1) { spread(node.x + 1, node.y); }
+		if (node.y > 0) { spread(node.x, node.y - 1); }
+		if (node.y < height - 1) { spread(node.x, node.y + 1); }
+	}
+
+	queue.Clear();
+}
+
+void Lighting::Unpropagate(Vector<LightRemoval>& removals, Vector<LightNode>& queue, U8 shift)
+{
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+
+	for (U64 head = 0; head < removals.Size(); ++head)
+	{
+		LightRemoval node = removals[head];
+
+		//Dimmer neighbours were lit through the removed tile and go dark too, brighter ones have their own
+		//light and become the boundary that floods back in afterwards
+		auto clear = [&](I32 nx, I32 ny) {
+			U32 neighbor = nx + ny * width;
+			U8 level = Level(neighbor, shift);
+
+			if (level == 0) { return; }
+
+			if (level < node.level)
+			{
+				SetLevel(neighbor, shift, 0);
+				World::DirtyTileRender(neighbor);
+				removals.Push({ (U16)nx, (U16)ny, level });
+
+				if (shift == LIGHT_BLOCK_SHIFT && IsSource((U16)nx, (U16)ny))
+				{
+					SetLevel(neighbor, shift, SourceLevel(neighbor));
+					queue.Push({ (U16)nx, (U16)ny });
+				}
+			}
+			else { queue.Push({ (U16)nx, (U16)ny }); }
+		};
+
+		if (node.x > 0) { clear(node.x - 1, node.y); }
+		if (node.x < width - 1) { clear(node.x + 1, node.y); }
+		if (node.y > 0) { clear(node.x, node.y - 1); }
+		if (node.y < height - 1) { clear(node.x, node.y + 1); }
+	}
+
+	removals.Clear();
+}
+
+void Lighting::Remove(U16 x, U16 y, Vector<LightRemoval>& removals, U8 shift)
+{
+	U32 index = x + y * World::TILE_COUNT_X;
+	U8 level = Level(index, shift);
+
+	if (level == 0) { return; }
+
+	SetLevel(index, shift, 0);
+	World::DirtyTileRender(index);
+	removals.Push({ x, y, level });
+}
+
+U8 Lighting::Level(U32 index, U8 shift)
+{
+	return (light[index] >> shift) & LIGHT_MAX;
+}
+
+void Lighting::SetLevel(U32 index, U8 shift, U8 level)
+{
+	light[index] = (U8)((light[index] & ~(LIGHT_MAX << shift)) | (level << shift));
+}
+
+bool Lighting::IsSource(U16 x, U16 y)
+{
+	return sourceMasks[(x >> CHUNK_SHIFT) + (y >> CHUNK_SHIFT) * World::CHUNK_COUNT_X] & ChunkBit(x, y);
+}
+
+U8 Lighting::SourceLevel(U32 index)
+{
+	for (const LightSource& source : sources)
+	{
+		if (source.index == index) { return source.level; }
+	}
+
+	return 0;
+}
+
+bool Lighting::Opaque(const Tile& tile)
+{
+	return BLOCKS.solid[tile.block];
+}
+
+bool Lighting::BlocksSky(const Tile& tile)
+{
+	return tile.block != U8_MAX || tile.wall != U8_MAX;
+}
\ No newline at end of file
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+struct Tile;
+
+constexpr U8 LIGHT_MAX = 15;
+constexpr U8 LIGHT_SUN_SHIFT = 0;
+constexpr U8 LIGHT_BLOCK_SHIFT = 4;
+constexpr U32 LIGHT_STRIP_CHUNKS = 4; //Strip width must be more than twice the light radius so same-parity strips never touch
+constexpr U32 LIGHT_MAX_STRIPS = (U32)(WORLD_SIZE_LARGE / CHUNK_SIZE / LIGHT_STRIP_CHUNKS + 1);
+constexpr F32 LIGHT_AMBIENT = 0.04f;
+
+static_assert(LIGHT_STRIP_CHUNKS * CHUNK_SIZE > LIGHT_MAX * 2, "Light strips are too narrow to update in parallel");
+
+struct LightNode
+{
+	U16 x;
+	U16 y;
+};
+
+struct LightRemoval
+{
+	U16 x;
+	U16 y;
+	U8 level;
+};
+
+struct LightSource
+{
+	U32 index;
+	U8 level;
+};
+
+/*
+* Per-tile light field, sunlight in the low nibble and block light in the high nibble of one byte per tile
+*
+* Sunlight fills open sky columns at full strength (everything at or above skyHeights[x]), everything else is a BFS flood fill that loses one level per tile
+* and stops spreading inside blocks. Edits relight incrementally: light that depended on the edited tile is cleared
+* through a removal queue, then the boundary of the cleared region is flooded back in
+*
+* A full relight splits the world into vertical strips and floods even then odd strips on Jobs workers
+*/
+class Lighting
+{
+public:
+	static void AddSource(U32 index, U8 level);
+	static void RemoveSource(U32 index);
+
+	static U8 SunLight(U32 index);
+	static U8 BlockLight(U32 index);
+	static F32 Brightness(U32 index);
+
+private:
+	static void Initialize();
+	static void Shutdown();
+	static void Reset();
+
+	static void Relight();
+	static void FindSkyHeights(U32 strip);
+	static void RelightStrip(U32 strip, Vector<LightNode>& queue);
+	static void TileChanged(U32 index, const Tile& previous);
+
+	static void Propagate(Vector<LightNode>& queue, U8 shift, bool markDirty);
+	static void Unpropagate(Vector<LightRemoval>& removals, Vector<LightNode>& queue, U8 shift);
+	static void Remove(U16 x, U16 y, Vector<LightRemoval>& removals, U8 shift);
+
+	static U8 Level(U32 index, U8 shift);
+	static void SetLevel(U32 index, U8 shift, U8 level);
+	static bool IsSource(U16 x, U16 y);
+	static U8 SourceLevel(U32 index);
+
+	static bool Opaque(const Tile& tile);
+	static bool BlocksSky(const Tile& tile);
+
+	static U8* light;
+	static U16* skyHeights;
+	static U64* sourceMasks;
+	static Vector<LightSource> sources;
+
+	static Vector<LightNode> stripQueues[LIGHT_MAX_STRIPS];
+	static Vector<LightNode> sunQueue;
+	static Vector<LightNode> blockQueue;
+	static Vector<LightRemoval> sunRemovals;
+	static Vector<LightRemoval> blockRemovals;
+
+	STATIC_CLASS(Lighting);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
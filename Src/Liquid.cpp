@@ -0,0 +1,287 @@
+#include "Liquid.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Platform\Jobs.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+
+U64* Liquid::activeMasks{ nullptr };
+U64* Liquid::nextMasks{ nullptr };
+bool* Liquid::queued{ nullptr };
+
+Vector<U32> Liquid::activeChunks;
+Vector<U32> Liquid::nextChunks;
+Vector<U32> Liquid::redChunks;
+Vector<U32> Liquid::blackChunks;
+
+Vector<LiquidTransfer> Liquid::transfers[LIQUID_MAX_GROUPS];
+Vector<TileDelta> Liquid::edits[LIQUID_MAX_GROUPS];
+U32 Liquid::groupCellCounts[LIQUID_MAX_GROUPS];
+U32 Liquid::cellsUpdated{ 0 };
+
+void Liquid::Initialize()
+{
+	Memory::AllocateStaticArray(&activeMasks, TOTAL_CHUNK_COUNT);
+	Memory::AllocateStaticArray(&nextMasks, TOTAL_CHUNK_COUNT);
+	Memory::AllocateStaticArray(&queued, TOTAL_CHUNK_COUNT);
+
+	activeChunks.Reserve(1024);
+	nextChunks.Reserve(1024);
+	redChunks.Reserve(512);
+	blackChunks.Reserve(512);
+
+	Reset();
+}
+
+void Liquid::Shutdown()
+{
+	activeChunks.Destroy();
+	nextChunks.Destroy();
+	redChunks.Destroy();
+	blackChunks.Destroy();
+
+	for (Vector<LiquidTransfer>& list : transfers) { list.Destroy(); }
+	for (Vector<TileDelta>& list : edits) { list.Destroy(); }
+}
+
+void Liquid::Reset()
+{
+	Memory::Zero(activeMasks, sizeof(U64) * TOTAL_CHUNK_COUNT);
+	Memory::Zero(nextMasks, sizeof(U64) * TOTAL_CHUNK_COUNT);
+	Memory::Zero(queued, sizeof(bool) * TOTAL_CHUNK_COUNT);
+
+	activeChunks.Clear();
+	nextChunks.Clear();
+	cellsUpdated = 0;
+}
+
+void Liquid::AddLiquid(U32 index, U8 amount)
+{
+	Tile& tile = World::tiles[index];
+	U8 previous = tile.liquidAmt;
+	tile.liquidAmt = (U8)Math::Min<U32>(tile.liquidAmt + amount, LIQUID_MAX);
+
+	History::Record(index, TILE_LAYER_LIQUID, previous, tile.liquidAmt);
+
+	Wake(index);
+	World::DirtyTile(index);
+}
+
+void Liquid::Wake(U32 index)
+{
+	U32 x = index % World::TILE_COUNT_X;
+	U32 y = index / World::TILE_COUNT_X;
+	U32 chunkIndex = (x >> CHUNK_SHIFT) + (y >> CHUNK_SHIFT) * World::CHUNK_COUNT_X;
+
+	nextMasks[chunkIndex] |= ChunkBit(x, y);
+
+	if (!queued[chunkIndex])
+	{
+		queued[chunkIndex] = true;
+		nextChunks.Push(chunkIndex);
+	}
+}
+
+U32 Liquid::ActiveChunkCount()
+{
+	return (U32)nextChunks.Size();
+}
+
+U32 Liquid::CellsUpdated()
+{
+	return cellsUpdated;
+}
+
+void Liquid::Update()
+{
+	cellsUpdated = 0;
+
+	if (nextChunks.Size() == 0) { return; }
+
+	//Everything woken since last tick becomes this tick's work
+	Swap(activeMasks, nextMasks);
+	Swap(activeChunks, nextChunks);
+	nextChunks.Clear();
+
+	redChunks.Clear();
+	blackChunks.Clear();
+
+	for (U32 chunkIndex : activeChunks)
+	{
+		queued[chunkIndex] = false;
+
+		U32 chunkX = chunkIndex % World::CHUNK_COUNT_X;
+		U32 chunkY = chunkIndex / World::CHUNK_COUNT_X;
+
+		if ((chunkX + chunkY) & 1) { blackChunks.Push(chunkIndex); }
+		else { redChunks.Push(chunkIndex); }
+	}
+
+	RunPhase(redChunks);
+	RunPhase(blackChunks);
+}
+
+void Liquid::RunPhase(Vector<U32>& phaseChunks)
+{
+	U32 chunkCount = (U32)phaseChunks.Size();
+	if (chunkCount == 0) { return; }
+
+	U32 groupCount = (chunkCount + LIQUID_GROUP_SIZE - 1) / LIQUID_GROUP_SIZE;
+
+	for (U32 i = 0; i < groupCount; ++i)
+	{
+		transfers[i].Clear();
+		edits[i].Clear();
+		groupCellCounts[i] = 0;
+	}
+
+	U32* chunkList = phaseChunks.Data();
+
+	Jobs::Dispatch(chunkCount, LIQUID_GROUP_SIZE, [chunkList](JobDispatchArgs args) {
+		UpdateChunk(chunkList[args.jobIndex], transfers[args.groupIndex], edits[args.groupIndex], groupCellCounts[args.groupIndex]);
+	});
+
+	Jobs::Wait();
+
+	//A chunk that changed always wakes itself, so its next mask doubles as the dirty flag
+	for (U32 chunkIndex : phaseChunks)
+	{
+		if (nextMasks[chunkIndex])
+		{
+			World::DirtyChunk(chunkIndex);
+
+			if (!queued[chunkIndex])
+			{
+				queued[chunkIndex] = true;
+				nextChunks.Push(chunkIndex);
+			}
+		}
+	}
+
+	for (U32 i = 0; i < groupCount; ++i)
+	{
+		cellsUpdated += groupCellCounts[i];
+		History::Record(edits[i]);
+
+		for (const LiquidTransfer& transfer : transfers[i])
+		{
+			Wake(transfer.to);
+
+			if (transfer.amount == 0) { continue; }
+
+			Tile& to = World::tiles[transfer.to];
+			U8 accepted = (U8)Math::Min<U32>(transfer.amount, LIQUID_MAX - to.liquidAmt);
+			History::Record(transfer.to, TILE_LAYER_LIQUID, to.liquidAmt, to.liquidAmt + accepted);
+			to.liquidAmt += accepted;
+			World::DirtyTile(transfer.to);
+
+			if (accepted < transfer.amount)
+			{
+				Tile& from = World::tiles[transfer.from];
+				U8 returned = transfer.amount - accepted;
+				History::Record(transfer.from, TILE_LAYER_LIQUID, from.liquidAmt, from.liquidAmt + returned);
+				from.liquidAmt += returned;
+				Wake(transfer.from);
+			}
+		}
+	}
+}
+
+void Liquid::UpdateChunk(U32 chunkIndex, Vector<LiquidTransfer>& outbox, Vector<TileDelta>& edits, U32& cellCount)
+{
+	U64 mask = activeMasks[chunkIndex];
+	activeMasks[chunkIndex] = 0;
+
+	Tile* tiles = World::tiles;
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+	const I32 chunkX = (chunkIndex % World::CHUNK_COUNT_X) << CHUNK_SHIFT;
+	const I32 chunkY = (chunkIndex / World::CHUNK_COUNT_X) << CHUNK_SHIFT;
+
+	//Lowest bits are the bottom rows, so liquid falls before it spreads
+	while (mask)
+	{
+		U64 bit = FirstSetBit(mask);
+		mask &= mask - 1;
+
+		I32 x = chunkX + (I32)(bit & CHUNK_MASK);
+		I32 y = chunkY + (I32)(bit >> CHUNK_SHIFT);
+		U32 index = x + y * width;
+		Tile& tile = tiles[index];
+
+		if (tile.liquidAmt == 0 || tile.block != U8_MAX) { continue; }
+
+		++cellCount;
+		U8 start = tile.liquidAmt;
+
+		auto inChunk = [&](I32 tx, I32 ty) { return (tx & ~CHUNK_MASK) == chunkX && (ty & ~CHUNK_MASK) == chunkY; };
+
+		auto wake = [&](I32 tx, I32 ty) {
+			if (tx < 0 || tx >= width || ty < 0 || ty >= height) { return; }
+
+			if (inChunk(tx, ty)) { WakeLocal(chunkIndex, tx, ty); }
+			else { outbox.Push({ index, (U32)(tx + ty * width), 0 }); }
+		};
+
+		auto move = [&](I32 tx, I32 ty, U8 amount) {
+			U32 target = tx + ty * width;
+			edits.Push({ index, TILE_LAYER_LIQUID, tile.liquidAmt, (U8)(tile.liquidAmt - amount) });
+			tile.liquidAmt -= amount;
+
+			if (inChunk(tx, ty))
+			{
+				edits.Push({ target, TILE_LAYER_LIQUID, tiles[target].liquidAmt, (U8)(tiles[target].liquidAmt + amount) });
+				tiles[target].liquidAmt += amount;
+				WakeLocal(chunkIndex, tx, ty);
+			}
+			else { outbox.Push({ index, target, amount }); }
+		};
+
+		if (y > 0)
+		{
+			const Tile& below = tiles[index - width];
+
+			if (below.block == U8_MAX && below.liquidAmt < LIQUID_MAX)
+			{
+				move(x, y - 1, (U8)Math::Min<U32>(tile.liquidAmt, LIQUID_MAX - below.liquidAmt));
+			}
+		}
+
+		if (tile.liquidAmt)
+		{
+			U8 amount = tile.liquidAmt;
+			U8 flowLeft = 0;
+			U8 flowRight = 0;
+
+			if (x > 0)
+			{
+				const Tile& left = tiles[index - 1];
+				if (left.block == U8_MAX && left.liquidAmt < amount) { flowLeft = (amount - left.liquidAmt) / 3; }
+			}
+
+			if (x < width - 1)
+			{
+				const Tile& right = tiles[index + 1];
+				if (right.block == U8_MAX && right.liquidAmt < amount) { flowRight = (amount - right.liquidAmt) / 3; }
+			}
+
+			if (flowLeft) { move(x - 1, y, flowLeft); }
+			if (flowRight) { move(x + 1, y, flowRight); }
+		}
+
+		//Unchanged cells drop out of the active set
+		if (tile.liquidAmt != start)
+		{
+			WakeLocal(chunkIndex, x, y);
+			wake(x, y + 1);
+			wake(x - 1, y);
+			wake(x + 1, y);
+		}
+	}
+}
+
+void Liquid::WakeLocal(U32 chunkIndex, I32 x, I32 y)
+{
+	nextMasks[chunkIndex] |= ChunkBit(x, y);
+}
\ No newline at end of file
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+#include "History.hpp"
+
+struct JobDispatchArgs;
+
+constexpr U8 LIQUID_MAX = U8_MAX;
+constexpr U32 LIQUID_GROUP_SIZE = 16;
+constexpr U32 LIQUID_MAX_GROUPS = (U32)(TOTAL_CHUNK_COUNT / LIQUID_GROUP_SIZE + 1);
+constexpr Vector3 LIQUID_COLOR{ 0.25f, 0.45f, 1.0f };
+
+/// <summary>
+/// Liquid that crossed into a neighbouring chunk, applied after the phase that produced it
+/// </summary>
+struct LiquidTransfer
+{
+	U32 from;
+	U32 to;
+	U8 amount;
+};
+
+/*
+* Falling/spreading simulation of Tile::liquidAmt
+*
+* Only cells that changed last tick (or were woken by an edit) are simulated, tracked as one 64-bit mask per chunk
+* plus a list of chunks with any bit set, so a settled lake costs nothing
+*
+* Chunks are updated in two checkerboard phases, red then black, on Jobs workers. During a phase a job only
+* writes to its own chunk, liquid that leaves the chunk is queued as a LiquidTransfer and applied once the phase finishes
+*/
+class Liquid
+{
+public:
+	static void AddLiquid(U32 index, U8 amount);
+	static void Wake(U32 index);
+
+	static U32 ActiveChunkCount();
+	static U32 CellsUpdated();
+
+private:
+	static void Initialize();
+	static void Shutdown();
+	static void Reset();
+
+	static void Update();
+	static void RunPhase(Vector<U32>& phaseChunks);
+	static void UpdateChunk(U32 chunkIndex, Vector<LiquidTransfer>& outbox, Vector<TileDelta>& edits, U32& cellCount);
+	static void WakeLocal(U32 chunkIndex, I32 x, I32 y);
+
+	static U64* activeMasks;
+	static U64* nextMasks;
+	static bool* queued;
+
+	static Vector<U32> activeChunks;
+	static Vector<U32> nextChunks;
+	static Vector<U32> redChunks;
+	static Vector<U32> blackChunks;
+
+	static Vector<LiquidTransfer> transfers[LIQUID_MAX_GROUPS];
+	static Vector<TileDelta> edits[LIQUID_MAX_GROUPS];
+	static U32 groupCellCounts[LIQUID_MAX_GROUPS];
+	static U32 cellsUpdated;
+
+	STATIC_CLASS(Liquid);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
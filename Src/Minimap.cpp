@@ -0,0 +1,231 @@
+#include "Minimap.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Platform\Jobs.hpp"
+#include "SIMD.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "TileRegistry.hpp"
+
+U32* Minimap::texels{ nullptr };
+U64* Minimap::dirtyMasks{ nullptr };
+MinimapLevel Minimap::levels[MINIMAP_MAX_LEVELS];
+U32 Minimap::levelCount{ 0 };
+
+//0xAABBGGRR, tile types take theirs from the registry
+static constexpr U32 MAP_LIQUID_COLOR = 0xFFC86428;
+static constexpr U32 MAP_SKY_COLOR = 0xFFEBCE87;
+
+/// <summary>
+/// Per channel average rounding up, the same as _mm_avg_epu8
+/// </summary>
+static U32 Average(U32 a, U32 b)
+{
+	return (a | b) - (((a ^ b) & 0xFEFEFEFE) >> 1);
+}
+
+//One row of a 2x2 reduction, right is inclusive
+static void ReduceRow(const U32* top, const U32* bottom, U32* out, U32 left, U32 right, U32 sourceWidth)
+{
+	U32 x = left;
+
+#ifdef NH_SSE2
+	//Four texels from eight source columns at a time, vertical pairs first then even and odd lanes
+	for (; x + 3 <= right && x * 2 + 7 < sourceWidth; x += 4)
+	{
+		__m128i low = _mm_avg_epu8(_mm_loadu_si128((const __m128i*)(top + x * 2)), _mm_loadu_si128((const __m128i*)(bottom + x * 2)));
+		__m128i high = _mm_avg_epu8(_mm_loadu_si128((const __m128i*)(top + x * 2 + 4)), _mm_loadu_si128((const __m128i*)(bottom + x * 2 + 4)));
+
+		__m128 even = _mm_shuffle_ps(_mm_castsi128_ps(low), _mm_castsi128_ps(high), _MM_SHUFFLE(2, 0, 2, 0));
+		__m128 odd = _mm_shuffle_ps(_mm_castsi128_ps(low), _mm_castsi128_ps(high), _MM_SHUFFLE(3, 1, 3, 1));
+
+		_mm_storeu_si128((__m128i*)(out + x), _mm_avg_epu8(_mm_castps_si128(even), _mm_castps_si128(odd)));
+	}
+#endif
+
+	for (; x <= right; ++x)
+	{
+		U32 second = Math::Min(x * 2 + 1, sourceWidth - 1);
+		out[x] = Average(Average(top[x * 2], bottom[x * 2]), Average(top[second], bottom[second]));
+	}
+}
+
+void Minimap::Initialize()
+{
+	//Sized for the largest world, every level rounds up
+	U64 width = WORLD_SIZE_LARGE;
+	U64 height = TOTAL_TILE_COUNT / WORLD_SIZE_LARGE;
+	U64 total = width * height;
+
+	while (width > 1 || height > 1)
+	{
+		width = (width + 1) / 2;
+		height = (height + 1) / 2;
+		total += width * height;
+	}
+
+	Memory::AllocateStaticArray(&texels, total);
+	Memory::AllocateStaticArray(&dirtyMasks, TOTAL_CHUNK_COUNT / 64 + 1);
+}
+
+void Minimap::Build()
+{
+	U32 width = World::TILE_COUNT_X;
+	U32 height = World::TILE_COUNT_Y;
+	U32 offset = 0;
+
+	levelCount = 0;
+
+	while (true)
+	{
+		levels[levelCount++] = { offset, width, height, 0, 0, (I32)width - 1, (I32)height - 1 };
+		offset += width * height;
+
+		if (width == 1 && height == 1) { break; }
+
+		width = (width + 1) / 2;
+		height = (height + 1) / 2;
+	}
+
+	Memory::Zero(dirtyMasks, sizeof(U64) * (TOTAL_CHUNK_COUNT / 64 + 1));
+
+	Jobs::Dispatch(World::TILE_COUNT_Y, 16, [](JobDispatchArgs args) {
+		U32 first = args.jobIndex * World::TILE_COUNT_X;
+
+		for (U32 i = first; i < first + World::TILE_COUNT_X; ++i) { texels[i] = TileColor(World::tiles[i]); }
+	});
+
+	Jobs::Wait();
+
+	for (U32 level = 1; level < levelCount; ++level)
+	{
+		const MinimapLevel& source = levels[level - 1];
+		const MinimapLevel& target = levels[level];
+
+		Jobs::Dispatch(target.height, 16, [&source, &target](JobDispatchArgs args) {
+			U32 y = args.jobIndex;
+			const U32* top = texels + source.offset + y * 2 * source.width;
+			const U32* bottom = texels + source.offset + Math::Min(y * 2 + 1, source.height - 1) * source.width;
+
+			ReduceRow(top, bottom, texels + target.offset + y * target.width, 0, target.width - 1, source.width);
+		});
+
+		Jobs::Wait();
+	}
+}
+
+void Minimap::Update()
+{
+	for (U32 word = 0; word < TOTAL_CHUNK_COUNT / 64 + 1; ++word)
+	{
+		while (dirtyMasks[word])
+		{
+			U32 chunkIndex = word * 64 + (U32)FirstSetBit(dirtyMasks[word]);
+			dirtyMasks[word] &= dirtyMasks[word] - 1;
+
+			U32 left = (chunkIndex % World::CHUNK_COUNT_X) * CHUNK_SIZE;
+			U32 bottom = (chunkIndex / World::CHUNK_COUNT_X) * CHUNK_SIZE;
+			U32 right = left + CHUNK_SIZE - 1;
+			U32 top = bottom + CHUNK_SIZE - 1;
+
+			for (U32 y = bottom; y <= top; ++y)
+			{
+				U32 index = left + y * World::TILE_COUNT_X;
+				for (U32 x = left; x <= right; ++x, ++index) { texels[index] = TileColor(World::tiles[index]); }
+			}
+
+			MarkDirty(levels[0], left, bottom, right, top);
+
+			for (U32 level = 1; level < levelCount; ++level)
+			{
+				left >>= 1;
+				bottom >>= 1;
+				right >>= 1;
+				top >>= 1;
+
+				Reduce(level, left, bottom, right, top);
+			}
+		}
+	}
+}
+
+void Minimap::DirtyChunk(U32 chunkIndex)
+{
+	dirtyMasks[chunkIndex >> 6] |= 1ull << (chunkIndex & 63);
+}
+
+U32 Minimap::TileColor(const Tile& tile)
+{
+	//Empty ids have no color, so the first layer with one shows
+	if (tile.block != U8_MAX) { return DECORATIONS.mapColor[tile.decoration] ? DECORATIONS.mapColor[tile.decoration] : BLOCKS.mapColor[tile.block]; }
+	if (tile.liquidAmt) { return MAP_LIQUID_COLOR; }
+	if (tile.wall != U8_MAX) { return WALLS.mapColor[tile.wall]; }
+
+	return MAP_SKY_COLOR;
+}
+
+void Minimap::Reduce(U32 level, U32 left, U32 bottom, U32 right, U32 top)
+{
+	const MinimapLevel& source = levels[level - 1];
+	const MinimapLevel& target = levels[level];
+
+	for (U32 y = bottom; y <= top; ++y)
+	{
+		const U32* sourceTop = texels + source.offset + y * 2 * source.width;
+		const U32* sourceBottom = texels + source.offset + Math::Min(y * 2 + 1, source.height - 1) * source.width;
+
+		ReduceRow(sourceTop, sourceBottom, texels + target.offset + y * target.width, left, right, source.width);
+	}
+
+	MarkDirty(levels[level], left, bottom, right, top);
+}
+
+void Minimap::MarkDirty(MinimapLevel& level, I32 left, I32 bottom, I32 right, I32 top)
+{
+	if (level.dirtyLeft > level.dirtyRight)
+	{
+		level.dirtyLeft = left;
+		level.dirtyBottom = bottom;
+		level.dirtyRight = right;
+		level.dirtyTop = top;
+		return;
+	}
+
+	level.dirtyLeft = Math::Min(level.dirtyLeft, left);
+	level.dirtyBottom = Math::Min(level.dirtyBottom, bottom);
+	level.dirtyRight = Math::Max(level.dirtyRight, right);
+	level.dirtyTop = Math::Max(level.dirtyTop, top);
+}
+
+const U32* Minimap::Texels(U32 level)
+{
+	return texels + levels[level].offset;
+}
+
+const MinimapLevel& Minimap::Level(U32 level)
+{
+	return levels[level];
+}
+
+U32 Minimap::LevelCount()
+{
+	return levelCount;
+}
+
+U32 Minimap::LevelForZoom(F32 tilesPerPixel)
+{
+	U32 level = 0;
+	while (level + 1 < levelCount && (F32)(1u << (level + 1)) <= tilesPerPixel) { ++level; }
+
+	return level;
+}
+
+void Minimap::ClearDirty()
+{
+	for (U32 level = 0; level < levelCount; ++level)
+	{
+		levels[level].dirtyLeft = 0;
+		levels[level].dirtyRight = -1;
+	}
+}
\ No newline at end of file
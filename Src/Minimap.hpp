@@ -0,0 +1,55 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+struct Tile;
+
+constexpr U32 MINIMAP_MAX_LEVELS = 16;
+
+struct MinimapLevel
+{
+	U32 offset; //Where the level's texels start
+	U32 width;
+	U32 height;
+	I32 dirtyLeft; //Texels changed since the last ClearDirty, left > right when clean
+	I32 dirtyBottom;
+	I32 dirtyRight;
+	I32 dirtyTop;
+};
+
+/*
+* Map view colors as a mip pyramid, level 0 is one RGBA texel per tile and every level above is a 2x2 box filter of
+* the one below, an odd last row or column is reused for the missing half
+*
+* Built after the world is generated, then World::DirtyChunk marks chunks for Update to recolor and carry up through
+* each level, so edits cost one chunk's texels plus a shrinking square per level. A zoomed out view reads the level
+* matching its scale and uploads that level's dirty rectangle
+*/
+class Minimap
+{
+public:
+	static const U32* Texels(U32 level);
+	static const MinimapLevel& Level(U32 level);
+	static U32 LevelCount();
+	static U32 LevelForZoom(F32 tilesPerPixel);
+	static void ClearDirty();
+
+private:
+	static void Initialize();
+	static void Build();
+	static void Update();
+	static void DirtyChunk(U32 chunkIndex);
+
+	static U32 TileColor(const Tile& tile);
+	static void Reduce(U32 level, U32 left, U32 bottom, U32 right, U32 top);
+	static void MarkDirty(MinimapLevel& level, I32 left, I32 bottom, I32 right, I32 top);
+
+	static U32* texels;
+	static U64* dirtyMasks;
+	static MinimapLevel levels[MINIMAP_MAX_LEVELS];
+	static U32 levelCount;
+
+	STATIC_CLASS(Minimap);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
@@ -0,0 +1,696 @@
+#include "Pathfinding.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Platform\Jobs.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "TileRegistry.hpp"
+
+U64* Pathfinding::nodeMasks{ nullptr };
+U32* Pathfinding::distanceOffsets{ nullptr };
+U16* Pathfinding::distanceCapacities{ nullptr };
+Vector<U8> Pathfinding::distances;
+U64 Pathfinding::wastedDistances{ 0 };
+
+U64* Pathfinding::dirtyMasks{ nullptr };
+Vector<U32> Pathfinding::dirtyChunks;
+
+PathScratch Pathfinding::scratches[PATH_MAX_GROUPS];
+Vector<PathRequest> Pathfinding::pending;
+Vector<PathRequest> Pathfinding::active;
+Vector<U32> Pathfinding::groupPaths[PATH_MAX_GROUPS];
+U32 Pathfinding::batch{ 0 };
+
+static constexpr U64 COLUMN_LEFT = 0x0101010101010101ull;
+static constexpr U64 COLUMN_RIGHT = 0x8080808080808080ull;
+
+/// <summary>
+/// Every tile of a chunk mask one step away from mask
+/// </summary>
+static U64 Expand(U64 mask)
+{
+	return ((mask << 1) & ~COLUMN_LEFT) | ((mask >> 1) & ~COLUMN_RIGHT) | (mask << CHUNK_SIZE) | (mask >> CHUNK_SIZE);
+}
+
+static U32 NodeIndex(U64 nodes, U64 bit)
+{
+	return (U32)BitCount(nodes & ((1ull << bit) - 1));
+}
+
+/// <summary>
+/// Steps from one tile of a chunk to every tile in targets, written in bit order
+/// </summary>
+static void Flood(U64 passable, U64 from, U64 targets, U8* steps)
+{
+	Memory::Set(steps, PATH_UNREACHABLE, BitCount(targets));
+
+	U64 visited = 1ull << from;
+	U64 frontier = visited;
+	U8 step = 0;
+
+	if (targets & visited) { steps[NodeIndex(targets, from)] = 0; }
+
+	while (frontier)
+	{
+		++step;
+		frontier = Expand(frontier) & passable & ~visited;
+		visited |= frontier;
+
+		U64 reached = frontier & targets;
+
+		while (reached)
+		{
+			U64 bit = FirstSetBit(reached);
+			reached &= reached - 1;
+
+			steps[NodeIndex(targets, bit)] = step;
+		}
+	}
+}
+
+void Pathfinding::Initialize()
+{
+	Memory::AllocateStaticArray(&nodeMasks, TOTAL_CHUNK_COUNT);
+	Memory::AllocateStaticArray(&distanceOffsets, TOTAL_CHUNK_COUNT);
+	Memory::AllocateStaticArray(&distanceCapacities, TOTAL_CHUNK_COUNT);
+	Memory::AllocateStaticArray(&dirtyMasks, TOTAL_CHUNK_COUNT / 64 + 1);
+}
+
+void Pathfinding::Shutdown()
+{
+	distances.Destroy();
+	dirtyChunks.Destroy();
+	pending.Destroy();
+	active.Destroy();
+
+	for (PathScratch& scratch : scratches)
+	{
+		scratch.records.Destroy();
+		scratch.heap.Destroy();
+		scratch.slots.Destroy();
+		scratch.points.Destroy();
+		scratch.path.Destroy();
+	}
+
+	for (Vector<U32>& paths : groupPaths) { paths.Destroy(); }
+}
+
+bool Pathfinding::FindPath(U32 start, U32 goal, Vector<U32>& path)
+{
+	RebuildDirty();
+
+	path.Clear();
+
+	if (!Search(start, goal, scratches[0])) { return false; }
+
+	path.Merge(scratches[0].path);
+	return true;
+}
+
+U32 Pathfinding::QueuePath(U32 start, U32 goal)
+{
+	if (pending.Size() == PATH_MAX_QUERIES) { return PATH_NONE; }
+
+	U32 ticket = (((batch + 1) & U16_MAX) << 16) | (U32)pending.Size();
+	pending.Push({ start, goal, 0, 0, 0, PATH_STATUS_PENDING });
+
+	return ticket;
+}
+
+PathStatus Pathfinding::GetPath(U32 ticket, const U32*& tiles, U32& length)
+{
+	U32 ticketBatch = ticket >> 16;
+	U32 index = ticket & U16_MAX;
+
+	tiles = nullptr;
+	length = 0;
+
+	if (ticketBatch == ((batch + 1) & U16_MAX) && index < pending.Size()) { return PATH_STATUS_PENDING; }
+	if (ticketBatch != (batch & U16_MAX) || index >= active.Size()) { return PATH_STATUS_EXPIRED; }
+
+	const PathRequest& request = active[index];
+
+	if (request.status == PATH_STATUS_FOUND)
+	{
+		tiles = groupPaths[request.group].Data() + request.offset;
+		length = request.length;
+	}
+
+	return request.status;
+}
+
+void Pathfinding::Build()
+{
+	U32 chunkCount = (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y;
+
+	Jobs::Dispatch(chunkCount, 256, [](JobDispatchArgs args) { nodeMasks[args.jobIndex] = FindNodes(args.jobIndex); });
+	Jobs::Wait();
+
+	//Tables are packed back to back, a chunk that later needs a bigger one moves to the end
+	U32 total = 0;
+
+	for (U32 i = 0; i < chunkCount; ++i)
+	{
+		U32 count = (U32)BitCount(nodeMasks[i]);
+		distanceOffsets[i] = total;
+		distanceCapacities[i] = (U16)(count * count);
+		total += count * count;
+	}
+
+	distances.Resize(total);
+	wastedDistances = 0;
+
+	Jobs::Dispatch(chunkCount, 256, [](JobDispatchArgs args) { FillDistances(args.jobIndex); });
+	Jobs::Wait();
+
+	Memory::Zero(dirtyMasks, sizeof(U64) * (TOTAL_CHUNK_COUNT / 64 + 1));
+	dirtyChunks.Clear();
+	pending.Clear();
+	active.Clear();
+}
+
+void Pathfinding::Update()
+{
+	RebuildDirty();
+
+	++batch;
+	Swap(pending, active);
+	pending.Clear();
+
+	U32 queryCount = (U32)active.Size();
+	if (queryCount == 0) { return; }
+
+	U32 groupSize = (queryCount + PATH_MAX_GROUPS - 1) / PATH_MAX_GROUPS;
+	U32 groupCount = (queryCount + groupSize - 1) / groupSize;
+
+	for (U32 i = 0; i < groupCount; ++i) { groupPaths[i].Clear(); }
+
+	PathRequest* requests = active.Data();
+
+	//A group runs on one worker, so it owns its scratch and its output list
+	Jobs::Dispatch(queryCount, groupSize, [requests](JobDispatchArgs args) {
+		PathRequest& request = requests[args.jobIndex];
+		PathScratch& scratch = scratches[args.groupIndex];
+		Vector<U32>& output = groupPaths[args.groupIndex];
+
+		request.group = args.groupIndex;
+
+		if (Search(request.start, request.goal, scratch))
+		{
+			request.offset = (U32)output.Size();
+			request.length = (U32)scratch.path.Size();
+			request.status = PATH_STATUS_FOUND;
+			output.Merge(scratch.path);
+		}
+		else { request.status = PATH_STATUS_NOT_FOUND; }
+	});
+
+	Jobs::Wait();
+}
+
+void Pathfinding::RebuildDirty()
+{
+	if (dirtyChunks.Size() == 0) { return; }
+
+	for (U32 chunkIndex : dirtyChunks)
+	{
+		dirtyMasks[chunkIndex >> 6] &= ~(1ull << (chunkIndex & 63));
+		RebuildChunk(chunkIndex);
+	}
+
+	dirtyChunks.Clear();
+
+	//Queued and finished queries are left alone, only Build at world setup drops them
+	if (wastedDistances > distances.Size() / 2) { RepackTables(); }
+}
+
+void Pathfinding::RepackTables()
+{
+	U32 chunkCount = (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y;
+	U32 total = 0;
+
+	for (U32 i = 0; i < chunkCount; ++i)
+	{
+		U32 count = (U32)BitCount(nodeMasks[i]);
+		total += count * count;
+	}
+
+	//Tables are copied back to back in chunk order, dropping the space left by chunks that moved to the end
+	Vector<U8> packed;
+	packed.Resize(total);
+
+	U32 offset = 0;
+
+	for (U32 i = 0; i < chunkCount; ++i)
+	{
+		U32 count = (U32)BitCount(nodeMasks[i]);
+		U32 size = count * count;
+
+		Memory::Copy(packed.Data() + offset, distances.Data() + distanceOffsets[i], size);
+		distanceOffsets[i] = offset;
+		distanceCapacities[i] = (U16)size;
+		offset += size;
+	}
+
+	Swap(distances, packed);
+	wastedDistances = 0;
+}
+
+void Pathfinding::Invalidate(U32 index)
+{
+	U32 x = index % World::TILE_COUNT_X;
+	U32 y = index / World::TILE_COUNT_X;
+	U32 chunkIndex = World::ChunkIndex(index);
+
+	InvalidateChunk(chunkIndex);
+
+	//Border tiles also decide the entrances of the chunk across the border
+	if ((x & CHUNK_MASK) == 0 && x > 0) { InvalidateChunk(chunkIndex - 1); }
+	if ((x & CHUNK_MASK) == CHUNK_MASK && x < (U32)World::TILE_COUNT_X - 1) { InvalidateChunk(chunkIndex + 1); }
+	if ((y & CHUNK_MASK) == 0 && y > 0) { InvalidateChunk(chunkIndex - World::CHUNK_COUNT_X); }
+	if ((y & CHUNK_MASK) == CHUNK_MASK && y < (U32)World::TILE_COUNT_Y - 1) { InvalidateChunk(chunkIndex + World::CHUNK_COUNT_X); }
+}
+
+void Pathfinding::InvalidateChunk(U32 chunkIndex)
+{
+	U64 bit = 1ull << (chunkIndex & 63);
+
+	if (!(dirtyMasks[chunkIndex >> 6] & bit))
+	{
+		dirtyMasks[chunkIndex >> 6] |= bit;
+		dirtyChunks.Push(chunkIndex);
+	}
+}
+
+U64 Pathfinding::PassableMask(U32 chunkIndex)
+{
+	const Tile* tile = World::tiles + World::FirstTile(chunkIndex);
+	U64 mask = 0;
+
+	for (U32 y = 0; y < CHUNK_SIZE; ++y)
+	{
+		for (U32 x = 0; x < CHUNK_SIZE; ++x)
+		{
+			if (!BLOCKS.solid[tile[x].block]) { mask |= 1ull << (x | (y << CHUNK_SHIFT)); }
+		}
+
+		tile += World::TILE_COUNT_X;
+	}
+
+	return mask;
+}
+
+U8 Pathfinding::BorderEntrances(U32 first, U32 across, U32 step)
+{
+	const Tile* tiles = World::tiles;
+	U32 open = 0;
+
+	for (U32 i = 0; i < CHUNK_SIZE; ++i)
+	{
+		if (!BLOCKS.solid[tiles[first + i * step].block] && !BLOCKS.solid[tiles[across + i * step].block]) { open |= 1u << i; }
+	}
+
+	//Both chunks of a border see the same openings, so they agree on where the entrances are
+	U32 entrances = 0;
+
+	while (open)
+	{
+		U32 begin = (U32)FirstSetBit(open);
+		U32 length = (U32)FirstSetBit(~(U64)(open >> begin));
+
+		if (length >= PATH_LONG_ENTRANCE) { entrances |= (1u << begin) | (1u << (begin + length - 1)); }
+		else { entrances |= 1u << (begin + (length - 1) / 2); }
+
+		open &= ~(((1u << length) - 1) << begin);
+	}
+
+	return (U8)entrances;
+}
+
+U64 Pathfinding::FindNodes(U32 chunkIndex)
+{
+	const U32 width = World::TILE_COUNT_X;
+	const U32 chunkX = chunkIndex % World::CHUNK_COUNT_X;
+	const U32 chunkY = chunkIndex / World::CHUNK_COUNT_X;
+	const U32 first = World::FirstTile(chunkIndex);
+
+	U64 nodes = 0;
+
+	if (chunkX > 0)
+	{
+		U8 entrances = BorderEntrances(first, first - 1, width);
+		for (U32 i = 0; i < CHUNK_SIZE; ++i) { if (entrances & (1u << i)) { nodes |= 1ull << (i << CHUNK_SHIFT); } }
+	}
+
+	if (chunkX < (U32)World::CHUNK_COUNT_X - 1)
+	{
+		U8 entrances = BorderEntrances(first + CHUNK_MASK, first + CHUNK_SIZE, width);
+		for (U32 i = 0; i < CHUNK_SIZE; ++i) { if (entrances & (1u << i)) { nodes |= 1ull << (CHUNK_MASK | (i << CHUNK_SHIFT)); } }
+	}
+
+	if (chunkY > 0)
+	{
+		nodes |= BorderEntrances(first, first - width, 1);
+	}
+
+	if (chunkY < (U32)World::CHUNK_COUNT_Y - 1)
+	{
+		nodes |= (U64)BorderEntrances(first + CHUNK_MASK * width, first + CHUNK_SIZE * width, 1) << (CHUNK_MASK << CHUNK_SHIFT);
+	}
+
+	return nodes;
+}
+
+void Pathfinding::FillDistances(U32 chunkIndex)
+{
+	U64 nodes = nodeMasks[chunkIndex];
+	if (!nodes) { return; }
+
+	U32 count = (U32)BitCount(nodes);
+	U64 passable = PassableMask(chunkIndex);
+	U8* row = distances.Data() + distanceOffsets[chunkIndex];
+
+	for (U64 mask = nodes; mask; mask &= mask - 1)
+	{
+		Flood(passable, FirstSetBit(mask), nodes, row);
+		row += count;
+	}
+}
+
+void Pathfinding::RebuildChunk(U32 chunkIndex)
+{
+	U64 nodes = FindNodes(chunkIndex);
+	U32 count = (U32)BitCount(nodes);
+	U32 size = count * count;
+
+	nodeMasks[chunkIndex] = nodes;
+
+	if (size > distanceCapacities[chunkIndex])
+	{
+		wastedDistances += distanceCapacities[chunkIndex];
+		distanceOffsets[chunkIndex] = (U32)distances.Size();
+		distanceCapacities[chunkIndex] = (U16)size;
+
+		U64 needed = distances.Size() + size;
+		if (needed > distances.Capacity()) { distances.Reserve(Math::Max(needed, distances.Capacity() * 2)); }
+		distances.Resize(needed);
+	}
+
+	FillDistances(chunkIndex);
+}
+
+bool Pathfinding::Search(U32 start, U32 goal, PathScratch& scratch)
+{
+	const Tile* tiles = World::tiles;
+	const U32 width = World::TILE_COUNT_X;
+
+	scratch.path.Clear();
+
+	if (BLOCKS.solid[tiles[start].block] || BLOCKS.solid[tiles[goal].block]) { return false; }
+
+	if (start == goal)
+	{
+		scratch.path.Push(goal);
+		return true;
+	}
+
+	if (scratch.slots.Size() == 0) { scratch.slots.Resize(4096); }
+
+	Memory::Set(scratch.slots.Data(), U8_MAX, sizeof(U32) * scratch.slots.Size());
+	scratch.records.Clear();
+	scratch.heap.Clear();
+
+	const U32 startChunk = World::ChunkIndex(start);
+	const U32 goalChunk = World::ChunkIndex(goal);
+	const U64 goalBit = LocalBit(goal);
+	const U64 goalNodes = nodeMasks[goalChunk];
+
+	U8 goalSteps[PATH_MAX_NODES];
+	Flood(PassableMask(goalChunk), goalBit, goalNodes, goalSteps);
+
+	Open(scratch, start, PATH_NONE, 0, goal);
+
+	while (scratch.heap.Size())
+	{
+		U32 current = PopHeap(scratch.heap);
+		PathRecord& record = scratch.records[current];
+
+		if (record.closed) { continue; }
+		record.closed = true;
+
+		const U32 tile = record.tile;
+		const U32 cost = record.cost;
+
+		if (tile == goal)
+		{
+			return Refine(scratch, current);
+		}
+
+		const U32 chunkIndex = World::ChunkIndex(tile);
+		const U32 first = World::FirstTile(chunkIndex);
+		const U64 nodes = nodeMasks[chunkIndex];
+		const U64 bit = LocalBit(tile);
+
+		//The start isn't a node, so it links to its chunk's nodes (and a goal in the same chunk) by flooding
+		if (tile == start)
+		{
+			U64 targets = nodes;
+			if (chunkIndex == goalChunk) { targets |= 1ull << goalBit; }
+
+			U8 steps[PATH_MAX_NODES + 1];
+			Flood(PassableMask(chunkIndex), bit, targets, steps);
+
+			U32 i = 0;
+			for (U64 mask = targets; mask; mask &= mask - 1, ++i)
+			{
+				if (steps[i] != PATH_UNREACHABLE) { Open(scratch, LocalTile(first, FirstSetBit(mask)), current, cost + steps[i], goal); }
+			}
+		}
+
+		if (!(nodes & (1ull << bit))) { continue; }
+
+		U32 count = (U32)BitCount(nodes);
+		U32 node = NodeIndex(nodes, bit);
+		const U8* row = distances.Data() + distanceOffsets[chunkIndex] + node * count;
+
+		U32 i = 0;
+		for (U64 mask = nodes; mask; mask &= mask - 1, ++i)
+		{
+			if (i != node && row[i] != PATH_UNREACHABLE) { Open(scratch, LocalTile(first, FirstSetBit(mask)), current, cost + row[i], goal); }
+		}
+
+		const U32 localX = (U32)(bit & CHUNK_MASK);
+		const U32 localY = (U32)(bit >> CHUNK_SHIFT);
+		const U32 chunkX = chunkIndex % World::CHUNK_COUNT_X;
+		const U32 chunkY = chunkIndex / World::CHUNK_COUNT_X;
+
+		if (localX == 0 && chunkX > 0 && (nodeMasks[chunkIndex - 1] & (1ull << (bit | CHUNK_MASK))))
+		{
+			Open(scratch, tile - 1, current, cost + 1, goal);
+		}
+
+		if (localX == CHUNK_MASK && chunkX < (U32)World::CHUNK_COUNT_X - 1 && (nodeMasks[chunkIndex + 1] & (1ull << (bit & ~(U64)CHUNK_MASK))))
+		{
+			Open(scratch, tile + 1, current, cost + 1, goal);
+		}
+
+		if (localY == 0 && chunkY > 0 && (nodeMasks[chunkIndex - World::CHUNK_COUNT_X] & (1ull << (bit | (CHUNK_MASK << CHUNK_SHIFT)))))
+		{
+			Open(scratch, tile - width, current, cost + 1, goal);
+		}
+
+		if (localY == CHUNK_MASK && chunkY < (U32)World::CHUNK_COUNT_Y - 1 && (nodeMasks[chunkIndex + World::CHUNK_COUNT_X] & (1ull << localX)))
+		{
+			Open(scratch, tile + width, current, cost + 1, goal);
+		}
+
+		if (chunkIndex == goalChunk && goalSteps[node] != PATH_UNREACHABLE)
+		{
+			Open(scratch, goal, current, cost + goalSteps[node], goal);
+		}
+	}
+
+	return false;
+}
+
+bool Pathfinding::Refine(PathScratch& scratch, U32 goalRecord)
+{
+	scratch.points.Clear();
+
+	for (U32 record = goalRecord; record != PATH_NONE; record = scratch.records[record].parent)
+	{
+		scratch.points.Push(scratch.records[record].tile);
+	}
+
+	Vector<U32>& path = scratch.path;
+	path.Push(scratch.points.Back());
+
+	//Points were pushed goal first, hops between chunks are single steps and hops inside a chunk get flooded again
+	for (U64 i = scratch.points.Size() - 1; i > 0; --i)
+	{
+		U32 from = scratch.points[i];
+		U32 to = scratch.points[i - 1];
+		U32 chunkIndex = World::ChunkIndex(from);
+
+		if (chunkIndex != World::ChunkIndex(to))
+		{
+			path.Push(to);
+			continue;
+		}
+
+		const U32 first = World::FirstTile(chunkIndex);
+		const U64 passable = PassableMask(chunkIndex);
+		const U64 target = 1ull << LocalBit(to);
+
+		U64 layers[CHUNK_TILE_COUNT];
+		U64 visited = 1ull << LocalBit(from);
+		U32 depth = 0;
+		layers[0] = visited;
+
+		while (!(layers[depth] & target))
+		{
+			U64 next = Expand(layers[depth]) & passable & ~visited;
+
+			//A table that's stale after an edit can name a hop the chunk no longer connects
+			if (!next || depth + 1 == CHUNK_TILE_COUNT)
+			{
+				path.Clear();
+				return false;
+			}
+
+			visited |= next;
+			layers[++depth] = next;
+		}
+
+		U64 start = path.Size();
+		path.Resize(start + depth);
+
+		U64 bit = LocalBit(to);
+
+		for (U32 d = depth; d > 0; --d)
+		{
+			path[start + d - 1] = LocalTile(first, bit);
+			bit = FirstSetBit(Expand(1ull << bit) & layers[d - 1]);
+		}
+	}
+
+	return true;
+}
+
+U32 Pathfinding::Open(PathScratch& scratch, U32 tile, U32 parent, U32 cost, U32 goal)
+{
+	U32 mask = (U32)scratch.slots.Size() - 1;
+	U32 hash = tile * 0x9E3779B1u;
+	U32 slot = (hash ^ (hash >> 16)) & mask;
+
+	while (scratch.slots[slot] != PATH_NONE && scratch.records[scratch.slots[slot]].tile != tile) { slot = (slot + 1) & mask; }
+
+	U32 index = scratch.slots[slot];
+
+	if (index == PATH_NONE)
+	{
+		index = (U32)scratch.records.Size();
+		scratch.records.Push({ tile, parent, cost, false });
+		scratch.slots[slot] = index;
+
+		if (scratch.records.Size() * 2 > scratch.slots.Size()) { Grow(scratch); }
+	}
+	else
+	{
+		PathRecord& record = scratch.records[index];
+		if (record.closed || cost >= record.cost) { return index; }
+
+		record.parent = parent;
+		record.cost = cost;
+	}
+
+	PushHeap(scratch.heap, { cost + Heuristic(tile, goal), index });
+
+	return index;
+}
+
+void Pathfinding::Grow(PathScratch& scratch)
+{
+	scratch.slots.Resize(scratch.slots.Size() * 2);
+	Memory::Set(scratch.slots.Data(), U8_MAX, sizeof(U32) * scratch.slots.Size());
+
+	U32 mask = (U32)scratch.slots.Size() - 1;
+
+	for (U32 i = 0; i < scratch.records.Size(); ++i)
+	{
+		U32 hash = scratch.records[i].tile * 0x9E3779B1u;
+		U32 slot = (hash ^ (hash >> 16)) & mask;
+
+		while (scratch.slots[slot] != PATH_NONE) { slot = (slot + 1) & mask; }
+
+		scratch.slots[slot] = i;
+	}
+}
+
+void Pathfinding::PushHeap(Vector<PathHeapEntry>& heap, const PathHeapEntry& entry)
+{
+	heap.Push(entry);
+
+	U64 i = heap.Size() - 1;
+
+	while (i)
+	{
+		U64 parent = (i - 1) / 2;
+		if (heap[parent].estimate <= entry.estimate) { break; }
+
+		heap[i] = heap[parent];
+		i = parent;
+	}
+
+	heap[i] = entry;
+}
+
+U32 Pathfinding::PopHeap(Vector<PathHeapEntry>& heap)
+{
+	U32 top = heap[0].record;
+	PathHeapEntry last;
+	heap.Pop(last);
+
+	U64 size = heap.Size();
+	if (size == 0) { return top; }
+
+	U64 i = 0;
+
+	while (true)
+	{
+		U64 child = i * 2 + 1;
+		if (child >= size) { break; }
+		if (child + 1 < size && heap[child + 1].estimate < heap[child].estimate) { ++child; }
+		if (last.estimate <= heap[child].estimate) { break; }
+
+		heap[i] = heap[child];
+		i = child;
+	}
+
+	heap[i] = last;
+
+	return top;
+}
+
+U32 Pathfinding::Heuristic(U32 a, U32 b)
+{
+	I32 width = World::TILE_COUNT_X;
+	I32 dx = (I32)(a % width) - (I32)(b % width);
+	I32 dy = (I32)(a / width) - (I32)(b / width);
+
+	return (U32)(Math::Abs(dx) + Math::Abs(dy));
+}
+
+U64 Pathfinding::LocalBit(U32 index)
+{
+	U32 x = index % World::TILE_COUNT_X;
+	U32 y = index / World::TILE_COUNT_X;
+
+	return (x & CHUNK_MASK) | ((y & CHUNK_MASK) << CHUNK_SHIFT);
+}
+
+U32 Pathfinding::LocalTile(U32 first, U64 bit)
+{
+	return first + (U32)(bit & CHUNK_MASK) + (U32)(bit >> CHUNK_SHIFT) * World::TILE_COUNT_X;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+constexpr U32 PATH_MAX_NODES = 16; //At most 4 entrances on each of a chunk's 4 borders
+constexpr U8 PATH_UNREACHABLE = U8_MAX;
+constexpr U32 PATH_LONG_ENTRANCE = 6; //Openings at least this wide get an entrance at each end instead of the middle
+constexpr U32 PATH_MAX_GROUPS = 64;
+constexpr U32 PATH_MAX_QUERIES = 65536;
+constexpr U32 PATH_NONE = U32_MAX;
+
+enum PathStatus
+{
+	PATH_STATUS_PENDING,
+	PATH_STATUS_FOUND,
+	PATH_STATUS_NOT_FOUND,
+	PATH_STATUS_EXPIRED,
+};
+
+struct PathRequest
+{
+	U32 start;
+	U32 goal;
+	U32 group;
+	U32 offset;
+	U32 length;
+	PathStatus status;
+};
+
+struct PathRecord
+{
+	U32 tile;
+	U32 parent;
+	U32 cost;
+	bool closed;
+};
+
+struct PathHeapEntry
+{
+	U32 estimate;
+	U32 record;
+};
+
+/// <summary>
+/// Per worker search state, reused between queries so a search doesn't allocate once warmed up
+/// </summary>
+struct PathScratch
+{
+	Vector<PathRecord> records;
+	Vector<PathHeapEntry> heap;
+	Vector<U32> slots;
+	Vector<U32> points;
+	Vector<U32> path;
+};
+
+/*
+* Hierarchical A* using chunks as clusters
+*
+* Every chunk border is split into openings where both sides are passable, each opening adds an entrance node on both
+* sides. A chunk's nodes are kept as a 64-bit mask of tiles (node k is the k-th set bit) with a table of the shortest
+* in-chunk distance between each pair, found with a bit-parallel flood fill over the chunk's passable mask
+*
+* Queries search the node graph, then refine each in-chunk hop with another flood fill. Editing a tile's block only
+* rebuilds the chunks whose nodes or distances it can affect
+*
+* QueuePath hands out a ticket, queued paths are searched on Jobs workers during the next tick and stay readable
+* through GetPath until the tick after that
+*/
+class Pathfinding
+{
+public:
+	static bool FindPath(U32 start, U32 goal, Vector<U32>& path);
+
+	static U32 QueuePath(U32 start, U32 goal);
+	static PathStatus GetPath(U32 ticket, const U32*& tiles, U32& length);
+
+private:
+	static void Initialize();
+	static void Shutdown();
+
+	static void Build();
+	static void Update();
+	static void RebuildDirty();
+	static void RepackTables();
+	static void Invalidate(U32 index);
+	static void InvalidateChunk(U32 chunkIndex);
+
+	static U64 PassableMask(U32 chunkIndex);
+	static U8 BorderEntrances(U32 first, U32 across, U32 step);
+	static U64 FindNodes(U32 chunkIndex);
+	static void FillDistances(U32 chunkIndex);
+	static void RebuildChunk(U32 chunkIndex);
+
+	static bool Search(U32 start, U32 goal, PathScratch& scratch);
+	static bool Refine(PathScratch& scratch, U32 goalRecord);
+	static U32 Open(PathScratch& scratch, U32 tile, U32 parent, U32 cost, U32 goal);
+	static void Grow(PathScratch& scratch);
+	static void PushHeap(Vector<PathHeapEntry>& heap, const PathHeapEntry& entry);
+	static U32 PopHeap(Vector<PathHeapEntry>& heap);
+
+	static U32 Heuristic(U32 a, U32 b);
+	static U64 LocalBit(U32 index);
+	static U32 LocalTile(U32 first, U64 bit);
+
+	static U64* nodeMasks;
+	static U32* distanceOffsets;
+	static U16* distanceCapacities;
+	static Vector<U8> distances;
+	static U64 wastedDistances;
+
+	static U64* dirtyMasks;
+	static Vector<U32> dirtyChunks;
+
+	static PathScratch scratches[PATH_MAX_GROUPS];
+	static Vector<PathRequest> pending;
+	static Vector<PathRequest> active;
+	static Vector<U32> groupPaths[PATH_MAX_GROUPS];
+	static U32 batch;
+
+	STATIC_CLASS(Pathfinding);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
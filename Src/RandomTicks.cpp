@@ -0,0 +1,115 @@
+#include "RandomTicks.hpp"
+
+#include "Platform\Jobs.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "TileRegistry.hpp"
+#include "Lighting.hpp"
+
+Vector<TileDelta> RandomTicks::groupEdits[RANDOM_TICK_MAX_GROUPS];
+U64 RandomTicks::editCount{ 0 };
+
+//Indexed by TileTick, the registry picks one for each tile type
+const RandomTickRule RandomTicks::tickRules[TILE_TICK_COUNT]{
+	nullptr,
+	RandomTicks::GrassTick,
+};
+
+U64 RandomTicks::EditCount()
+{
+	return editCount;
+}
+
+void RandomTicks::Update()
+{
+	//World::chunkPos is the view's center chunk, relative to the middle of the world
+	I32 centerX = World::chunkPos.x + World::CHUNK_COUNT_X / 2;
+	I32 centerY = World::chunkPos.y + World::CHUNK_COUNT_Y / 2;
+
+	TickRegion(Math::Max(centerX - RANDOM_TICK_RANGE_X, 0), Math::Max(centerY - RANDOM_TICK_RANGE_Y, 0),
+		Math::Min(centerX + RANDOM_TICK_RANGE_X, World::CHUNK_COUNT_X - 1), Math::Min(centerY + RANDOM_TICK_RANGE_Y, World::CHUNK_COUNT_Y - 1));
+}
+
+void RandomTicks::TickRegion(I32 left, I32 bottom, I32 right, I32 top)
+{
+	if (left > right || bottom > top) { return; }
+
+	U32 width = right - left + 1;
+	U32 chunkCount = width * (top - bottom + 1);
+	U32 groupSize = (chunkCount + RANDOM_TICK_MAX_GROUPS - 1) / RANDOM_TICK_MAX_GROUPS;
+	U32 groupCount = (chunkCount + groupSize - 1) / groupSize;
+
+	for (U32 i = 0; i < groupCount; ++i) { groupEdits[i].Clear(); }
+
+	Jobs::Dispatch(chunkCount, groupSize, [left, bottom, width](JobDispatchArgs args) {
+		U32 x = left + args.jobIndex % width;
+		U32 y = bottom + args.jobIndex / width;
+
+		TickChunk(x + y * World::CHUNK_COUNT_X, groupEdits[args.groupIndex]);
+	});
+
+	Jobs::Wait();
+
+	for (U32 i = 0; i < groupCount; ++i)
+	{
+		for (const TileDelta& edit : groupEdits[i]) { World::SetTile(edit.index, edit.layer, edit.to); }
+
+		editCount += groupEdits[i].Size();
+	}
+}
+
+void RandomTicks::TickChunk(U32 chunkIndex, Vector<TileDelta>& edits)
+{
+	const U32 first = World::FirstTile(chunkIndex);
+
+	for (U32 pick = 0; pick < RANDOM_TICKS_PER_CHUNK; ++pick)
+	{
+		U64 random = Random(chunkIndex, pick);
+		U32 index = first + (U32)(random & CHUNK_MASK) + (U32)((random >> CHUNK_SHIFT) & CHUNK_MASK) * World::TILE_COUNT_X;
+		const Tile& tile = World::tiles[index];
+
+		RandomTickRule rule = tickRules[DECORATIONS.tick[tile.decoration]];
+		if (rule) { rule(index, tile, random >> (CHUNK_SHIFT * 2), edits); }
+	}
+}
+
+U64 RandomTicks::Random(U32 chunkIndex, U32 pick)
+{
+	//SplitMix64 finalizer over the counter
+	U64 value = (U64)World::SEED ^ (World::tick * 0x9E3779B97F4A7C15ull) ^ (((U64)chunkIndex * RANDOM_TICKS_PER_CHUNK + pick) * 0xD1B54A32D192ED03ull);
+
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
+
+void RandomTicks::GrassTick(U32 index, const Tile& tile, U64 random, Vector<TileDelta>& edits)
+{
+	const I32 width = World::TILE_COUNT_X;
+	const I32 height = World::TILE_COUNT_Y;
+	const I32 x = index % width;
+	const I32 y = index / width;
+
+	//Grass dies once something covers it
+	if (y + 1 < height && World::tiles[index + width].block != U8_MAX)
+	{
+		edits.Push({ index, TILE_LAYER_DECORATION, tile.decoration, U8_MAX });
+		return;
+	}
+
+	//Spread to one of the six tiles left and right of this one, a step up or down included
+	I32 targetX = x + ((random & 1) ? 1 : -1);
+	I32 targetY = y + (I32)((random >> 1) % 3) - 1;
+
+	if (targetX < 0 || targetX >= width || targetY < 0 || targetY + 1 >= height) { return; }
+
+	U32 target = World::TileIndex(targetX, targetY);
+	const Tile& targetTile = World::tiles[target];
+
+	if (BLOCKS.grassy[targetTile.block] && targetTile.decoration == U8_MAX && World::tiles[target + width].block == U8_MAX &&
+		Lighting::SunLight(target + width) >= GRASS_MIN_LIGHT)
+	{
+		edits.Push({ target, TILE_LAYER_DECORATION, U8_MAX, tile.decoration });
+	}
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+#include "History.hpp"
+
+struct Tile;
+
+constexpr U32 RANDOM_TICKS_PER_CHUNK = 3;
+constexpr I32 RANDOM_TICK_RANGE_X = 24; //Chunks simulated either side of the view's center chunk
+constexpr I32 RANDOM_TICK_RANGE_Y = 16;
+constexpr U32 RANDOM_TICK_MAX_GROUPS = 64;
+constexpr U8 GRASS_MIN_LIGHT = 9; //Sunlight grass needs above a dirt block to spread onto it
+
+/// <summary>
+/// Decides what a randomly ticked tile does, random holds bits the rule is free to use
+/// </summary>
+using RandomTickRule = void(*)(U32 index, const Tile& tile, U64 random, Vector<TileDelta>& edits);
+
+/*
+* Random ticks for slow tile behaviour, like grass spreading onto lit dirt and dying under blocks
+*
+* Every tick each chunk in a range around the view gets RANDOM_TICKS_PER_CHUNK tiles picked by a counter-based RNG:
+* a hash of the seed, the tick, the chunk and the pick. Nothing carries between picks, so chunks can tick on any
+* worker in any order and replaying a tick picks the same tiles
+*
+* Rules only read the world and write edits into their group's list. Once every chunk is done the lists are applied
+* in group order through World::SetTile, which records History and dirties the chunks
+*/
+class RandomTicks
+{
+public:
+	static U64 EditCount();
+
+private:
+	static void Update();
+	static void TickRegion(I32 left, I32 bottom, I32 right, I32 top);
+	static void TickChunk(U32 chunkIndex, Vector<TileDelta>& edits);
+	static U64 Random(U32 chunkIndex, U32 pick);
+
+	static void GrassTick(U32 index, const Tile& tile, U64 random, Vector<TileDelta>& edits);
+
+	static const RandomTickRule tickRules[];
+	static Vector<TileDelta> groupEdits[RANDOM_TICK_MAX_GROUPS];
+	static U64 editCount;
+
+	STATIC_CLASS(RandomTicks);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
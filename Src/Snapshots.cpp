@@ -0,0 +1,404 @@
+#include "Snapshots.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Core\Time.hpp"
+
+#include "World.hpp"
+#include "Tile.hpp"
+#include "History.hpp"
+
+static_assert(sizeof(Tile) * CHUNK_TILE_COUNT == sizeof(SnapshotBlock), "A snapshot block must hold exactly one chunk");
+
+Snapshot Snapshots::ring[SNAPSHOT_COUNT];
+U32* Snapshots::leafTables{ nullptr };
+U32 Snapshots::head{ SNAPSHOT_COUNT - 1 };
+U32 Snapshots::current{ SNAPSHOT_COUNT - 1 };
+U32 Snapshots::count{ 0 };
+
+Vector<SnapshotBlock*> Snapshots::pages;
+Vector<U16> Snapshots::refCounts;
+BitFreelist Snapshots::freeBlocks;
+
+F64 Snapshots::lastRestoreTime{ 0.0 };
+U32 Snapshots::lastRestoreChunkCount{ 0 };
+
+void Snapshots::Initialize()
+{
+	Memory::AllocateStaticArray(&leafTables, SNAPSHOT_LEAF_COUNT * SNAPSHOT_COUNT);
+
+	for (U32 i = 0; i < SNAPSHOT_COUNT; ++i) { ring[i].leaves = leafTables + SNAPSHOT_LEAF_COUNT * i; }
+
+	Reset();
+}
+
+void Snapshots::Shutdown()
+{
+	for (SnapshotBlock* page : pages) { Memory::Free(&page); }
+
+	pages.Destroy();
+	refCounts.Destroy();
+	freeBlocks.Destroy();
+}
+
+void Snapshots::Reset()
+{
+	//Pages are kept around, every block just goes back to being unused
+	head = SNAPSHOT_COUNT - 1;
+	current = head;
+	count = 0;
+	freeBlocks.Reset();
+}
+
+void Snapshots::Capture()
+{
+	Truncate();
+
+	const Snapshot* previous = count ? ring + head : nullptr;
+
+	head = (head + 1) % SNAPSHOT_COUNT;
+	current = head;
+
+	if (count == SNAPSHOT_COUNT) { ReleaseSnapshot(ring[head]); }
+	else { ++count; }
+
+	Snapshot& snapshot = ring[head];
+	snapshot.tick = World::tick;
+	snapshot.memory = sizeof(U32) * SNAPSHOT_LEAF_COUNT;
+
+	U64* edited = World::editedChunks;
+	U32 leafCount = LeafCount();
+
+	for (U32 leaf = 0; leaf < leafCount; ++leaf)
+	{
+		U64 mask = edited[leaf] & LeafMask(leaf);
+
+		if (previous && !mask)
+		{
+			snapshot.leaves[leaf] = previous->leaves[leaf];
+			Retain(snapshot.leaves[leaf]);
+			continue;
+		}
+
+		U32 handle = AllocateBlock();
+		U32* children = (U32*)Block(handle)->data;
+
+		if (previous)
+		{
+			Memory::Copy(children, Block(previous->leaves[leaf])->data, sizeof(SnapshotBlock));
+
+			for (U32 i = 0; i < 64; ++i)
+			{
+				if (children[i] != SNAPSHOT_NONE) { Retain(children[i]); }
+			}
+		}
+		else
+		{
+			Memory::Set(children, U8_MAX, sizeof(SnapshotBlock));
+			mask = LeafMask(leaf);
+		}
+
+		U64 added = 0;
+
+		while (mask)
+		{
+			U64 bit = FirstSetBit(mask);
+			mask &= mask - 1;
+
+			U32 chunkIndex = leaf * 64 + (U32)bit;
+			U32 child = children[bit];
+
+			//Edits that were undone before the capture don't cost a copy
+			if (child != SNAPSHOT_NONE)
+			{
+				if (ChunkMatches(chunkIndex, Block(child))) { continue; }
+
+				Release(child);
+			}
+
+			children[bit] = AllocateBlock();
+			CopyChunk(chunkIndex, Block(children[bit]));
+			added += sizeof(SnapshotBlock);
+		}
+
+		if (previous && !added)
+		{
+			ReleaseLeaf(handle);
+			snapshot.leaves[leaf] = previous->leaves[leaf];
+			Retain(snapshot.leaves[leaf]);
+		}
+		else
+		{
+			snapshot.leaves[leaf] = handle;
+			snapshot.memory += added + sizeof(SnapshotBlock);
+		}
+	}
+
+	Memory::Zero(edited, sizeof(U64) * leafCount);
+}
+
+bool Snapshots::Restore(U32 age)
+{
+	if (age >= count) { return false; }
+
+	Timer timer;
+	timer.Start();
+
+	U32 slot = (head + SNAPSHOT_COUNT - age) % SNAPSHOT_COUNT;
+	const Snapshot& target = ring[slot];
+	const Snapshot& synced = ring[current];
+
+	U64* edited = World::editedChunks;
+	U32 leafCount = LeafCount();
+	lastRestoreChunkCount = 0;
+
+	//The world differs from the target wherever the snapshot it was last synced to does, plus anything edited since
+	History::applying = true;
+
+	for (U32 leaf = 0; leaf < leafCount; ++leaf)
+	{
+		U64 mask = edited[leaf];
+
+		if (target.leaves[leaf] == synced.leaves[leaf] && !mask) { continue; }
+
+		const U32* targetChildren = (const U32*)Block(target.leaves[leaf])->data;
+		const U32* syncedChildren = (const U32*)Block(synced.leaves[leaf])->data;
+
+		if (target.leaves[leaf] != synced.leaves[leaf])
+		{
+			for (U32 i = 0; i < 64; ++i)
+			{
+				if (targetChildren[i] != syncedChildren[i]) { mask |= 1ull << i; }
+			}
+		}
+
+		mask &= LeafMask(leaf);
+
+		while (mask)
+		{
+			U64 bit = FirstSetBit(mask);
+			mask &= mask - 1;
+
+			RestoreChunk(leaf * 64 + (U32)bit, Block(targetChildren[bit]));
+			++lastRestoreChunkCount;
+		}
+	}
+
+	History::applying = false;
+	History::pending.Clear();
+
+	Memory::Zero(edited, sizeof(U64) * leafCount);
+	current = slot;
+	World::tick = target.tick;
+	World::tickTimer = 0.0;
+
+	lastRestoreTime = timer.CurrentTime();
+
+	return true;
+}
+
+void Snapshots::Truncate()
+{
+	//Snapshots newer than the one the world was restored to belong to a timeline that no longer exists
+	while (head != current)
+	{
+		ReleaseSnapshot(ring[head]);
+		head = (head + SNAPSHOT_COUNT - 1) % SNAPSHOT_COUNT;
+		--count;
+	}
+}
+
+void Snapshots::TruncateAfter(U64 tick)
+{
+	U32 kept = count;
+	U32 slot = head;
+	bool dropsCurrent = false;
+
+	while (kept && ring[slot].tick > tick)
+	{
+		dropsCurrent |= slot == current;
+		slot = (slot + SNAPSHOT_COUNT - 1) % SNAPSHOT_COUNT;
+		--kept;
+	}
+
+	if (kept == count) { return; }
+
+	//The world was synced to a dropped snapshot, chunks where the newest kept one differs count as edited so Restore and Capture still see them
+	if (dropsCurrent && kept)
+	{
+		const Snapshot& synced = ring[current];
+		const Snapshot& newest = ring[slot];
+		U64* edited = World::editedChunks;
+		U32 leafCount = LeafCount();
+
+		for (U32 leaf = 0; leaf < leafCount; ++leaf)
+		{
+			if (synced.leaves[leaf] == newest.leaves[leaf]) { continue; }
+
+			const U32* syncedChildren = (const U32*)Block(synced.leaves[leaf])->data;
+			const U32* newestChildren = (const U32*)Block(newest.leaves[leaf])->data;
+
+			for (U32 i = 0; i < 64; ++i)
+			{
+				if (syncedChildren[i] != newestChildren[i]) { edited[leaf] |= 1ull << i; }
+			}
+
+			edited[leaf] &= LeafMask(leaf);
+		}
+	}
+
+	for (U32 dropped = count - kept; dropped; --dropped)
+	{
+		ReleaseSnapshot(ring[head]);
+		head = (head + SNAPSHOT_COUNT - 1) % SNAPSHOT_COUNT;
+	}
+
+	//With nothing kept the next capture copies every chunk, so the edited chunks don't matter
+	if (dropsCurrent) { current = head; }
+	count = kept;
+}
+
+U32 Snapshots::Count()
+{
+	return count;
+}
+
+U64 Snapshots::SnapshotTick(U32 age)
+{
+	return ring[(head + SNAPSHOT_COUNT - age) % SNAPSHOT_COUNT].tick;
+}
+
+U64 Snapshots::SnapshotMemory(U32 age)
+{
+	return ring[(head + SNAPSHOT_COUNT - age) % SNAPSHOT_COUNT].memory;
+}
+
+U64 Snapshots::TotalMemory()
+{
+	return sizeof(SnapshotBlock) * (freeBlocks.Capacity() - freeBlocks.FreeCount()) + sizeof(U32) * SNAPSHOT_LEAF_COUNT * count;
+}
+
+F64 Snapshots::LastRestoreTime()
+{
+	return lastRestoreTime;
+}
+
+U32 Snapshots::LastRestoreChunkCount()
+{
+	return lastRestoreChunkCount;
+}
+
+U32 Snapshots::AllocateBlock()
+{
+	if (freeBlocks.Full())
+	{
+		SnapshotBlock* page;
+		Memory::AllocateArray(&page, SNAPSHOT_PAGE_SIZE);
+		pages.Push(page);
+		refCounts.Resize(freeBlocks.Capacity() + SNAPSHOT_PAGE_SIZE);
+		freeBlocks.Resize(freeBlocks.Capacity() + SNAPSHOT_PAGE_SIZE);
+	}
+
+	U32 handle = freeBlocks.GetFree();
+
+	refCounts[handle] = 1;
+	return handle;
+}
+
+void Snapshots::Retain(U32 handle)
+{
+	++refCounts[handle];
+}
+
+bool Snapshots::Release(U32 handle)
+{
+	if (--refCounts[handle]) { return false; }
+
+	freeBlocks.Release(handle);
+	return true;
+}
+
+void Snapshots::ReleaseLeaf(U32 handle)
+{
+	if (!Release(handle)) { return; }
+
+	//A freed block keeps its contents until it is handed out again
+	const U32* children = (const U32*)Block(handle)->data;
+
+	for (U32 i = 0; i < 64; ++i)
+	{
+		if (children[i] != SNAPSHOT_NONE) { Release(children[i]); }
+	}
+}
+
+void Snapshots::ReleaseSnapshot(const Snapshot& snapshot)
+{
+	U32 leafCount = LeafCount();
+
+	for (U32 leaf = 0; leaf < leafCount; ++leaf) { ReleaseLeaf(snapshot.leaves[leaf]); }
+}
+
+SnapshotBlock* Snapshots::Block(U32 handle)
+{
+	return pages[handle / SNAPSHOT_PAGE_SIZE] + handle % SNAPSHOT_PAGE_SIZE;
+}
+
+U32 Snapshots::LeafCount()
+{
+	return ((U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y + 63) / 64;
+}
+
+U64 Snapshots::LeafMask(U32 leaf)
+{
+	U32 remaining = (U32)World::CHUNK_COUNT_X * World::CHUNK_COUNT_Y - leaf * 64;
+
+	return remaining >= 64 ? U64_MAX : (1ull << remaining) - 1;
+}
+
+void Snapshots::CopyChunk(U32 chunkIndex, SnapshotBlock* block)
+{
+	const Tile* src = World::tiles + World::FirstTile(chunkIndex);
+	Tile* dst = (Tile*)block->data;
+
+	for (U32 y = 0; y < CHUNK_SIZE; ++y)
+	{
+		Memory::Copy(dst, src, sizeof(Tile) * CHUNK_SIZE);
+		dst += CHUNK_SIZE;
+		src += World::TILE_COUNT_X;
+	}
+}
+
+bool Snapshots::ChunkMatches(U32 chunkIndex, const SnapshotBlock* block)
+{
+	const Tile* src = World::tiles + World::FirstTile(chunkIndex);
+	const U64* data = block->data;
+
+	//A row of 8 tiles is 4 words
+	for (U32 y = 0; y < CHUNK_SIZE; ++y)
+	{
+		if (!Memory::Compare((const U64*)src, data, 4)) { return false; }
+
+		data += 4;
+		src += World::TILE_COUNT_X;
+	}
+
+	return true;
+}
+
+void Snapshots::RestoreChunk(U32 chunkIndex, const SnapshotBlock* block)
+{
+	U32 index = World::FirstTile(chunkIndex);
+	const Tile* src = (const Tile*)block->data;
+	const U32* row = (const U32*)src;
+
+	for (U32 y = 0; y < CHUNK_SIZE; ++y)
+	{
+		for (U32 x = 0; x < CHUNK_SIZE; ++x)
+		{
+			if (*(const U32*)(World::tiles + index + x) != row[x]) { World::ReplaceTile(index + x, src[x]); }
+		}
+
+		src += CHUNK_SIZE;
+		row += CHUNK_SIZE;
+		index += World::TILE_COUNT_X;
+	}
+}
\ No newline at end of file
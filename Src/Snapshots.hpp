@@ -0,0 +1,91 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+#include "Containers\BitFreelist.hpp"
+
+constexpr U32 SNAPSHOT_COUNT = 64;
+constexpr U32 SNAPSHOT_INTERVAL = 30; //Ticks between automatic snapshots
+constexpr U32 SNAPSHOT_PAGE_SIZE = 1024; //Blocks per page, one 256kb region
+constexpr U32 SNAPSHOT_LEAF_COUNT = (U32)(TOTAL_CHUNK_COUNT / 64 + 1);
+constexpr U32 SNAPSHOT_NONE = U32_MAX;
+
+/// <summary>
+/// 256 bytes holding either the 64 tiles of a chunk or the 64 chunk block handles of a leaf
+/// </summary>
+struct SnapshotBlock
+{
+	U64 data[32];
+};
+
+struct Snapshot
+{
+	U64 tick;
+	U64 memory; //Bytes this snapshot added on top of the ones it shares
+	U32* leaves;
+};
+
+/*
+* Bounded ring of copy-on-write world snapshots
+*
+* A snapshot is a two level table: one leaf per 64 chunks (one word of World::editedChunks), each leaf holding
+* the handles of its 64 chunk blocks. Blocks and leaves are reference counted, a capture only copies the chunks
+* edited since the previous snapshot and shares every other leaf and block with it
+*
+* Restoring only writes back chunks whose block differs from the current state, through World::ReplaceTile so
+* lighting, liquid and rendering see the same edits as any other. Newer snapshots stay until the next capture (or
+* Truncate) so History can seek forward through them, capturing after a restore starts a new timeline. When History
+* truncates its log it drops the snapshots past the cut too (TruncateAfter), stepping back then ticking never leaves
+* keyframes from the abandoned timeline behind
+*/
+class Snapshots
+{
+public:
+	static void Capture();
+	static bool Restore(U32 age);
+	static void Truncate();
+	static void TruncateAfter(U64 tick);
+
+	static U32 Count();
+	static U64 SnapshotTick(U32 age);
+	static U64 SnapshotMemory(U32 age);
+	static U64 TotalMemory();
+	static F64 LastRestoreTime();
+	static U32 LastRestoreChunkCount();
+
+private:
+	static void Initialize();
+	static void Shutdown();
+	static void Reset();
+
+	static U32 AllocateBlock();
+	static void Retain(U32 handle);
+	static bool Release(U32 handle);
+	static void ReleaseLeaf(U32 handle);
+	static void ReleaseSnapshot(const Snapshot& snapshot);
+	static SnapshotBlock* Block(U32 handle);
+
+	static U32 LeafCount();
+	static U64 LeafMask(U32 leaf);
+	static void CopyChunk(U32 chunkIndex, SnapshotBlock* block);
+	static bool ChunkMatches(U32 chunkIndex, const SnapshotBlock* block);
+	static void RestoreChunk(U32 chunkIndex, const SnapshotBlock* block);
+
+	static Snapshot ring[SNAPSHOT_COUNT];
+	static U32* leafTables;
+	static U32 head;
+	static U32 current;
+	static U32 count;
+
+	static Vector<SnapshotBlock*> pages;
+	static Vector<U16> refCounts;
+	static BitFreelist freeBlocks; //Lowest free block first, so live blocks stay packed in the first pages
+
+	static F64 lastRestoreTime;
+	static U32 lastRestoreChunkCount;
+
+	STATIC_CLASS(Snapshots);
+	friend class World;
+	friend class Benchmarks;
+};
\ No newline at end of file
@@ -0,0 +1,375 @@
+#include "SpatialGrid.hpp"
+
+#include "Memory\Memory.hpp"
+#include "Platform\Jobs.hpp"
+
+Vector<GridCell> SpatialGrid::cells;
+Vector<U32> SpatialGrid::table;
+Vector<GridEntry> SpatialGrid::entries;
+Vector<GridLocation> SpatialGrid::locations;
+U64 SpatialGrid::wastedEntries{ 0 };
+U32 SpatialGrid::entityCount{ 0 };
+
+Vector<U64> SpatialGrid::keys;
+Vector<GridLocation> SpatialGrid::assigned;
+Vector<GridEntry> SpatialGrid::compacted;
+Vector<U32> SpatialGrid::crossers[GRID_MAX_GROUPS];
+
+static U64 HashKey(U64 key)
+{
+	key ^= key >> 33;
+	key *= 0xFF51AFD7ED558CCDull;
+	key ^= key >> 33;
+	key *= 0xC4CEB9FE1A85EC53ull;
+	return key ^ (key >> 33);
+}
+
+void SpatialGrid::Shutdown()
+{
+	cells.Destroy();
+	table.Destroy();
+	entries.Destroy();
+	locations.Destroy();
+	keys.Destroy();
+	assigned.Destroy();
+	compacted.Destroy();
+
+	for (Vector<U32>& list : crossers) { list.Destroy(); }
+}
+
+void SpatialGrid::Clear()
+{
+	cells.Clear();
+	entries.Clear();
+	if (table.Size()) { Memory::Set(table.Data(), U8_MAX, sizeof(U32) * table.Size()); }
+	if (locations.Size()) { Memory::Set(locations.Data(), U8_MAX, sizeof(GridLocation) * locations.Size()); }
+
+	wastedEntries = 0;
+	entityCount = 0;
+}
+
+void SpatialGrid::Insert(Entity entity, const Vector2& position)
+{
+	EnsureLocation(entity.index);
+
+	if (locations[entity.index].cell != GRID_NONE) { Remove(entries[cells[locations[entity.index].cell].offset + locations[entity.index].slot].entity); }
+
+	U64 key = CellKey(position);
+	U32 cellIndex = FindCell(key);
+	if (cellIndex == GRID_NONE) { cellIndex = AddCell(key); }
+
+	AddEntry(cellIndex, { entity, position });
+	++entityCount;
+}
+
+void SpatialGrid::Remove(Entity entity)
+{
+	if (entity.index >= locations.Size()) { return; }
+
+	GridLocation& location = locations[entity.index];
+	if (location.cell == GRID_NONE || !(entries[cells[location.cell].offset + location.slot].entity == entity)) { return; }
+
+	RemoveEntry(location.cell, location.slot);
+	location.cell = GRID_NONE;
+	--entityCount;
+}
+
+void SpatialGrid::Move(Entity entity, const Vector2& position)
+{
+	if (entity.index < locations.Size())
+	{
+		const GridLocation& location = locations[entity.index];
+
+		if (location.cell != GRID_NONE && cells[location.cell].key == CellKey(position))
+		{
+			entries[cells[location.cell].offset + location.slot].position = position;
+			return;
+		}
+	}
+
+	Insert(entity, position);
+}
+
+void SpatialGrid::MoveAll(const Entity* entities, const Vector2* positions, U32 count)
+{
+	if (count == 0) { return; }
+
+	U32 groupSize = (count + GRID_MAX_GROUPS - 1) / GRID_MAX_GROUPS;
+	U32 groupCount = (count + groupSize - 1) / groupSize;
+
+	for (U32 i = 0; i < groupCount; ++i) { crossers[i].Clear(); }
+
+	//Workers only write the entries of entities staying in their cell, each entry belongs to one entity
+	Jobs::Dispatch(count, groupSize, [entities, positions](JobDispatchArgs args) {
+		const Entity& entity = entities[args.jobIndex];
+
+		if (entity.index < locations.Size())
+		{
+			const GridLocation& location = locations[entity.index];
+
+			if (location.cell != GRID_NONE && cells[location.cell].key == CellKey(positions[args.jobIndex]))
+			{
+				entries[cells[location.cell].offset + location.slot].position = positions[args.jobIndex];
+				return;
+			}
+		}
+
+		crossers[args.groupIndex].Push(args.jobIndex);
+	});
+
+	Jobs::Wait();
+
+	for (U32 i = 0; i < groupCount; ++i)
+	{
+		for (U32 index : crossers[i]) { Insert(entities[index], positions[index]); }
+	}
+}
+
+void SpatialGrid::Rebuild(const Entity* entities, const Vector2* positions, U32 count)
+{
+	Clear();
+
+	if (count == 0) { return; }
+
+	if (count > keys.Capacity()) { keys.Reserve(Math::Max((U64)count, keys.Capacity() * 2)); }
+	if (count > assigned.Capacity()) { assigned.Reserve(Math::Max((U64)count, assigned.Capacity() * 2)); }
+	keys.Resize(count);
+	assigned.Resize(count);
+
+	U64* keyData = keys.Data();
+	Jobs::Dispatch(count, 1024, [positions, keyData](JobDispatchArgs args) { keyData[args.jobIndex] = CellKey(positions[args.jobIndex]); });
+	Jobs::Wait();
+
+	//Counting every cell gives each entity its slot, then cells are laid out with room to grow
+	U32 maxIndex = 0;
+
+	for (U32 i = 0; i < count; ++i)
+	{
+		U32 cellIndex = FindCell(keys[i]);
+		if (cellIndex == GRID_NONE) { cellIndex = AddCell(keys[i]); }
+
+		assigned[i] = { cellIndex, cells[cellIndex].count++ };
+		maxIndex = Math::Max(maxIndex, entities[i].index);
+	}
+
+	U32 total = 0;
+
+	for (GridCell& cell : cells)
+	{
+		cell.offset = total;
+		cell.capacity = Math::Max(cell.count + cell.count / 2, GRID_MIN_CELL_CAPACITY);
+		total += cell.capacity;
+	}
+
+	if (total > entries.Capacity()) { entries.Reserve(Math::Max((U64)total, entries.Capacity() * 2)); }
+	entries.Resize(total);
+	EnsureLocation(maxIndex);
+
+	GridLocation* assignedData = assigned.Data();
+	Jobs::Dispatch(count, 1024, [entities, positions, assignedData](JobDispatchArgs args) {
+		const GridLocation& location = assignedData[args.jobIndex];
+
+		entries[cells[location.cell].offset + location.slot] = { entities[args.jobIndex], positions[args.jobIndex] };
+		locations[entities[args.jobIndex].index] = location;
+	});
+
+	Jobs::Wait();
+
+	entityCount = count;
+}
+
+void SpatialGrid::QueryBox(const Vector2& min, const Vector2& max, Vector<Entity>& results)
+{
+	I32 left = CellCoordinate(min.x);
+	I32 right = CellCoordinate(max.x);
+	I32 bottom = CellCoordinate(min.y);
+	I32 top = CellCoordinate(max.y);
+
+	for (I32 y = bottom; y <= top; ++y)
+	{
+		for (I32 x = left; x <= right; ++x)
+		{
+			U32 cellIndex = FindCell(CellKey(x, y));
+			if (cellIndex == GRID_NONE) { continue; }
+
+			const GridCell& cell = cells[cellIndex];
+			const GridEntry* entry = entries.Data() + cell.offset;
+
+			for (U32 i = 0; i < cell.count; ++i, ++entry)
+			{
+				if (entry->position.x >= min.x && entry->position.x <= max.x && entry->position.y >= min.y && entry->position.y <= max.y) { results.Push(entry->entity); }
+			}
+		}
+	}
+}
+
+void SpatialGrid::QueryRadius(const Vector2& center, F32 radius, Vector<Entity>& results)
+{
+	I32 left = CellCoordinate(center.x - radius);
+	I32 right = CellCoordinate(center.x + radius);
+	I32 bottom = CellCoordinate(center.y - radius);
+	I32 top = CellCoordinate(center.y + radius);
+	F32 radiusSquared = radius * radius;
+
+	for (I32 y = bottom; y <= top; ++y)
+	{
+		for (I32 x = left; x <= right; ++x)
+		{
+			U32 cellIndex = FindCell(CellKey(x, y));
+			if (cellIndex == GRID_NONE) { continue; }
+
+			const GridCell& cell = cells[cellIndex];
+			const GridEntry* entry = entries.Data() + cell.offset;
+
+			for (U32 i = 0; i < cell.count; ++i, ++entry)
+			{
+				F32 dx = entry->position.x - center.x;
+				F32 dy = entry->position.y - center.y;
+
+				if (dx * dx + dy * dy <= radiusSquared) { results.Push(entry->entity); }
+			}
+		}
+	}
+}
+
+U32 SpatialGrid::Count()
+{
+	return entityCount;
+}
+
+I32 SpatialGrid::CellCoordinate(F32 position)
+{
+	return (I32)Math::Floor(position / GRID_CELL_SIZE);
+}
+
+U64 SpatialGrid::CellKey(I32 x, I32 y)
+{
+	return ((U64)(U32)x << 32) | (U32)y;
+}
+
+U64 SpatialGrid::CellKey(const Vector2& position)
+{
+	return CellKey(CellCoordinate(position.x), CellCoordinate(position.y));
+}
+
+U32 SpatialGrid::FindCell(U64 key)
+{
+	if (table.Size() == 0) { return GRID_NONE; }
+
+	U64 mask = table.Size() - 1;
+
+	for (U64 i = HashKey(key) & mask; ; i = (i + 1) & mask)
+	{
+		U32 cellIndex = table[i];
+		if (cellIndex == GRID_NONE || cells[cellIndex].key == key) { return cellIndex; }
+	}
+}
+
+U32 SpatialGrid::AddCell(U64 key)
+{
+	//Kept under half full so probes stay short
+	if ((cells.Size() + 1) * 2 > table.Size()) { GrowTable(); }
+
+	U32 cellIndex = (U32)cells.Size();
+	cells.Push({ key, (U32)entries.Size(), 0, 0 });
+
+	U64 mask = table.Size() - 1;
+	U64 i = HashKey(key) & mask;
+	while (table[i] != GRID_NONE) { i = (i + 1) & mask; }
+
+	table[i] = cellIndex;
+	return cellIndex;
+}
+
+void SpatialGrid::GrowTable()
+{
+	table.Resize(Math::Max(table.Size() * 2, 1024ull));
+	Memory::Set(table.Data(), U8_MAX, sizeof(U32) * table.Size());
+
+	U64 mask = table.Size() - 1;
+
+	for (U32 cellIndex = 0; cellIndex < cells.Size(); ++cellIndex)
+	{
+		U64 i = HashKey(cells[cellIndex].key) & mask;
+		while (table[i] != GRID_NONE) { i = (i + 1) & mask; }
+
+		table[i] = cellIndex;
+	}
+}
+
+void SpatialGrid::EnsureLocation(U32 index)
+{
+	U64 size = locations.Size();
+	if (index < size) { return; }
+
+	U64 needed = (U64)index + 1;
+	if (needed > locations.Capacity()) { locations.Reserve(Math::Max(needed, locations.Capacity() * 2)); }
+
+	locations.Resize(needed);
+	Memory::Set(locations.Data() + size, U8_MAX, sizeof(GridLocation) * (needed - size));
+}
+
+void SpatialGrid::AddEntry(U32 cellIndex, const GridEntry& entry)
+{
+	//Compacting leaves every cell some slack, so the cell usually has room after it
+	if (cells[cellIndex].count == cells[cellIndex].capacity && wastedEntries > entries.Size() / 2) { Compact(); }
+
+	if (cells[cellIndex].count == cells[cellIndex].capacity)
+	{
+		//Out of room, move the cell to the end with twice the space
+		GridCell& cell = cells[cellIndex];
+		U32 capacity = Math::Max(cell.capacity * 2, GRID_MIN_CELL_CAPACITY);
+		U64 offset = entries.Size();
+		U64 needed = offset + capacity;
+
+		if (needed > entries.Capacity()) { entries.Reserve(Math::Max(needed, entries.Capacity() * 2)); }
+		entries.Resize(needed);
+
+		Memory::Copy(entries.Data() + offset, entries.Data() + cell.offset, sizeof(GridEntry) * cell.count);
+
+		wastedEntries += cell.capacity;
+		cell.offset = (U32)offset;
+		cell.capacity = capacity;
+	}
+
+	GridCell& cell = cells[cellIndex];
+	U32 slot = cell.count++;
+
+	entries[cell.offset + slot] = entry;
+	locations[entry.entity.index] = { cellIndex, slot };
+}
+
+void SpatialGrid::RemoveEntry(U32 cellIndex, U32 slot)
+{
+	GridCell& cell = cells[cellIndex];
+	U32 last = --cell.count;
+
+	if (slot == last) { return; }
+
+	GridEntry& moved = entries[cell.offset + last];
+	entries[cell.offset + slot] = moved;
+	locations[moved.entity.index].slot = slot;
+}
+
+void SpatialGrid::Compact()
+{
+	U64 total = 0;
+	for (const GridCell& cell : cells) { total += Math::Max(cell.count + cell.count / 2, GRID_MIN_CELL_CAPACITY); }
+
+	if (total > compacted.Capacity()) { compacted.Reserve(Math::Max(total, compacted.Capacity() * 2)); }
+	compacted.Resize(total);
+
+	U32 offset = 0;
+
+	for (GridCell& cell : cells)
+	{
+		Memory::Copy(compacted.Data() + offset, entries.Data() + cell.offset, sizeof(GridEntry) * cell.count);
+
+		cell.offset = offset;
+		cell.capacity = Math::Max(cell.count + cell.count / 2, GRID_MIN_CELL_CAPACITY);
+		offset += cell.capacity;
+	}
+
+	Swap(entries, compacted);
+	wastedEntries = 0;
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+#include "Entities.hpp"
+
+constexpr F32 GRID_CELL_SIZE = TILE_WIDTH * CHUNK_SIZE; //One cell per world chunk
+constexpr U32 GRID_MIN_CELL_CAPACITY = 4;
+constexpr U32 GRID_MAX_GROUPS = 64;
+constexpr U32 GRID_NONE = U32_MAX;
+
+struct GridEntry
+{
+	Entity entity;
+	Vector2 position;
+};
+
+struct GridCell
+{
+	U64 key;
+	U32 offset; //Where the cell's entries start in entries
+	U32 count;
+	U32 capacity;
+};
+
+struct GridLocation
+{
+	U32 cell;
+	U32 slot;
+};
+
+/*
+* Spatial hash of entity positions, one cell per world chunk
+*
+* Cells are found through an open addressing table keyed by chunk coordinate, so positions outside the world still
+* hash. Each cell's entries are packed back to back in one array with some slack, a cell that outgrows its space
+* moves to the end with double the capacity and the array is compacted once half of it is dead space
+*
+* Every entity remembers its cell and slot, moving inside a cell just overwrites the position and crossing into
+* another is a swap remove and an append. MoveAll checks the whole batch on Jobs workers and only handles the ones
+* that crossed a cell border on the calling thread
+*/
+class SpatialGrid
+{
+public:
+	static void Insert(Entity entity, const Vector2& position);
+	static void Remove(Entity entity);
+	static void Move(Entity entity, const Vector2& position);
+	static void MoveAll(const Entity* entities, const Vector2* positions, U32 count);
+	static void Rebuild(const Entity* entities, const Vector2* positions, U32 count);
+	static void Clear();
+
+	static void QueryBox(const Vector2& min, const Vector2& max, Vector<Entity>& results);
+	static void QueryRadius(const Vector2& center, F32 radius, Vector<Entity>& results);
+	static U32 Count();
+
+private:
+	static void Shutdown();
+
+	static I32 CellCoordinate(F32 position);
+	static U64 CellKey(I32 x, I32 y);
+	static U64 CellKey(const Vector2& position);
+	static U32 FindCell(U64 key);
+	static U32 AddCell(U64 key);
+	static void GrowTable();
+	static void EnsureLocation(U32 index);
+
+	static void AddEntry(U32 cellIndex, const GridEntry& entry);
+	static void RemoveEntry(U32 cellIndex, U32 slot);
+	static void Compact();
+
+	static Vector<GridCell> cells;
+	static Vector<U32> table;
+	static Vector<GridEntry> entries;
+	static Vector<GridLocation> locations;
+	static U64 wastedEntries;
+	static U32 entityCount;
+
+	static Vector<U64> keys;
+	static Vector<GridLocation> assigned;
+	static Vector<GridEntry> compacted;
+	static Vector<U32> crossers[GRID_MAX_GROUPS];
+
+	STATIC_CLASS(SpatialGrid);
+	friend class Timeslip;
+	friend class Benchmarks;
+};
\ No newline at end of file
@@ -2,6 +2,14 @@
 
 #include "Defines.hpp"
 
+enum TileLayer
+{
+	TILE_LAYER_WALL,
+	TILE_LAYER_BLOCK,
+	TILE_LAYER_DECORATION,
+	TILE_LAYER_LIQUID,
+};
+
 struct Tile
 {
 	Tile() {}
@@ -0,0 +1,257 @@
+#include "TileEntities.hpp"
+
+#include "Memory\Memory.hpp"
+
+#include "World.hpp"
+
+Vector<TileEntity> TileEntities::entities[TILE_ENTITY_TYPE_COUNT];
+Vector<TileEntitySlot> TileEntities::positions;
+Vector<TileEntitySlot> TileEntities::chunks;
+U32 TileEntities::positionCount{ 0 };
+U32 TileEntities::chunkCount{ 0 };
+
+static U32 HashKey(U32 key)
+{
+	key ^= key >> 16;
+	key *= 0x7FEB352Du;
+	key ^= key >> 15;
+	key *= 0x846CA68Bu;
+	return key ^ (key >> 16);
+}
+
+TileEntity* TileEntities::Create(I32 x, I32 y, TileEntityType type)
+{
+	U32 position = Pack(x, y);
+	if (FindSlot(positions, position) != U32_MAX) { return nullptr; }
+
+	Vector<TileEntity>& list = entities[type];
+	U32 handle = ((U32)type << TILE_ENTITY_SLOT_BITS) | (U32)list.Size();
+	U32 chunkIndex = ChunkOf(position);
+	U32 head = ChunkHead(chunkIndex);
+
+	TileEntity tileEntity{};
+	tileEntity.position = position;
+	tileEntity.chunkPrevious = TILE_ENTITY_NONE;
+	tileEntity.chunkNext = head;
+	tileEntity.type = type;
+
+	switch (type)
+	{
+	case TILE_ENTITY_CHEST: { Memory::Set(tileEntity.chest.items, U8_MAX, sizeof(tileEntity.chest.items)); } break;
+	case TILE_ENTITY_TORCH: { tileEntity.torch.fuel = U16_MAX; } break;
+	}
+
+	if (head != TILE_ENTITY_NONE) { Resolve(head).chunkPrevious = handle; }
+	SetChunkHead(chunkIndex, handle);
+	InsertSlot(positions, positionCount, position, handle);
+
+	list.Push(tileEntity);
+	return &list.Back();
+}
+
+TileEntity* TileEntities::Get(I32 x, I32 y)
+{
+	U32 slot = FindSlot(positions, Pack(x, y));
+	if (slot == U32_MAX) { return nullptr; }
+
+	return &Resolve(positions[slot].handle);
+}
+
+bool TileEntities::Destroy(I32 x, I32 y)
+{
+	U32 position = Pack(x, y);
+	U32 slot = FindSlot(positions, position);
+	if (slot == U32_MAX) { return false; }
+
+	U32 handle = positions[slot].handle;
+	EraseSlot(positions, positionCount, slot);
+
+	TileEntity& tileEntity = Resolve(handle);
+
+	//Unlink from the chunk's list, the chunk leaves its table once the list is empty
+	if (tileEntity.chunkPrevious != TILE_ENTITY_NONE) { Resolve(tileEntity.chunkPrevious).chunkNext = tileEntity.chunkNext; }
+	else { SetChunkHead(ChunkOf(position), tileEntity.chunkNext); }
+
+	if (tileEntity.chunkNext != TILE_ENTITY_NONE) { Resolve(tileEntity.chunkNext).chunkPrevious = tileEntity.chunkPrevious; }
+
+	//The last of this type takes the freed slot, everything pointing at it gets the new handle
+	Vector<TileEntity>& list = entities[tileEntity.type];
+	U32 last = (U32)list.Size() - 1;
+	U32 index = handle & ((1u << TILE_ENTITY_SLOT_BITS) - 1);
+
+	if (index != last)
+	{
+		list[index] = list[last];
+		Relink(list[index], handle);
+	}
+
+	list.Pop();
+	return true;
+}
+
+void TileEntities::Clear()
+{
+	for (Vector<TileEntity>& list : entities) { list.Clear(); }
+	if (positions.Size()) { Memory::Set(positions.Data(), U8_MAX, sizeof(TileEntitySlot) * positions.Size()); }
+	if (chunks.Size()) { Memory::Set(chunks.Data(), U8_MAX, sizeof(TileEntitySlot) * chunks.Size()); }
+
+	positionCount = 0;
+	chunkCount = 0;
+}
+
+U32 TileEntities::Count()
+{
+	return positionCount;
+}
+
+U32 TileEntities::Count(TileEntityType type)
+{
+	return (U32)entities[type].Size();
+}
+
+U32 TileEntities::Pack(I32 x, I32 y)
+{
+	return (U32)x | ((U32)y << 16);
+}
+
+void TileEntities::Shutdown()
+{
+	for (Vector<TileEntity>& list : entities) { list.Destroy(); }
+	positions.Destroy();
+	chunks.Destroy();
+
+	positionCount = 0;
+	chunkCount = 0;
+}
+
+void TileEntities::Update()
+{
+	TickTorches();
+	TickFurnaces();
+}
+
+void TileEntities::TickTorches()
+{
+	Vector<TileEntity>& torches = entities[TILE_ENTITY_TORCH];
+
+	//Walked backward so burnt out torches can be swap removed on the way
+	for (U32 i = (U32)torches.Size(); i-- > 0;)
+	{
+		TileEntity& torch = torches[i];
+		if (torch.torch.fuel == U16_MAX) { continue; } //Never burns out
+
+		if (torch.torch.fuel) { --torch.torch.fuel; }
+		else { Destroy(torch.position & U16_MAX, torch.position >> 16); }
+	}
+}
+
+void TileEntities::TickFurnaces()
+{
+	for (TileEntity& furnace : entities[TILE_ENTITY_FURNACE])
+	{
+		FurnaceState& state = furnace.furnace;
+		if (!state.fuel || !state.input) { state.progress = 0; continue; }
+
+		--state.fuel;
+
+		if (++state.progress == FURNACE_SMELT_TICKS)
+		{
+			--state.input;
+			++state.output;
+			state.progress = 0;
+		}
+	}
+}
+
+TileEntity& TileEntities::Resolve(U32 handle)
+{
+	return entities[handle >> TILE_ENTITY_SLOT_BITS][handle & ((1u << TILE_ENTITY_SLOT_BITS) - 1)];
+}
+
+U32 TileEntities::ChunkOf(U32 position)
+{
+	return ((position & U16_MAX) >> CHUNK_SHIFT) + ((position >> 16) >> CHUNK_SHIFT) * World::CHUNK_COUNT_X;
+}
+
+U32 TileEntities::ChunkHead(U32 chunkIndex)
+{
+	U32 slot = FindSlot(chunks, chunkIndex);
+	return slot == U32_MAX ? TILE_ENTITY_NONE : chunks[slot].handle;
+}
+
+void TileEntities::SetChunkHead(U32 chunkIndex, U32 handle)
+{
+	U32 slot = FindSlot(chunks, chunkIndex);
+
+	if (slot == U32_MAX) { InsertSlot(chunks, chunkCount, chunkIndex, handle); }
+	else if (handle == TILE_ENTITY_NONE) { EraseSlot(chunks, chunkCount, slot); }
+	else { chunks[slot].handle = handle; }
+}
+
+void TileEntities::Relink(const TileEntity& tileEntity, U32 handle)
+{
+	positions[FindSlot(positions, tileEntity.position)].handle = handle;
+
+	if (tileEntity.chunkPrevious != TILE_ENTITY_NONE) { Resolve(tileEntity.chunkPrevious).chunkNext = handle; }
+	else { SetChunkHead(ChunkOf(tileEntity.position), handle); }
+
+	if (tileEntity.chunkNext != TILE_ENTITY_NONE) { Resolve(tileEntity.chunkNext).chunkPrevious = handle; }
+}
+
+U32 TileEntities::FindSlot(const Vector<TileEntitySlot>& table, U32 key)
+{
+	if (table.Size() == 0) { return U32_MAX; }
+
+	U32 mask = (U32)table.Size() - 1;
+
+	for (U32 i = HashKey(key) & mask; ; i = (i + 1) & mask)
+	{
+		if (table[i].key == key) { return i; }
+		if (table[i].key == U32_MAX) { return U32_MAX; }
+	}
+}
+
+void TileEntities::InsertSlot(Vector<TileEntitySlot>& table, U32& count, U32 key, U32 handle)
+{
+	//Kept under half full so probes stay short
+	if ((count + 1) * 2 > table.Size())
+	{
+		Vector<TileEntitySlot> old = Move(table);
+
+		table.Resize(Math::Max(old.Size() * 2, (U64)TILE_ENTITY_MIN_TABLE));
+		Memory::Set(table.Data(), U8_MAX, sizeof(TileEntitySlot) * table.Size());
+		count = 0;
+
+		for (const TileEntitySlot& slot : old)
+		{
+			if (slot.key != U32_MAX) { InsertSlot(table, count, slot.key, slot.handle); }
+		}
+	}
+
+	U32 mask = (U32)table.Size() - 1;
+	U32 i = HashKey(key) & mask;
+	while (table[i].key != U32_MAX) { i = (i + 1) & mask; }
+
+	table[i] = { key, handle };
+	++count;
+}
+
+void TileEntities::EraseSlot(Vector<TileEntitySlot>& table, U32& count, U32 slot)
+{
+	U32 mask = (U32)table.Size() - 1;
+
+	//Pull back any later entry of the probe run whose home is at or before the hole
+	for (U32 i = (slot + 1) & mask; table[i].key != U32_MAX; i = (i + 1) & mask)
+	{
+		U32 home = HashKey(table[i].key) & mask;
+
+		if (((i - home) & mask) >= ((i - slot) & mask))
+		{
+			table[slot] = table[i];
+			slot = i;
+		}
+	}
+
+	table[slot].key = U32_MAX;
+	--count;
+}
\ No newline at end of file
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "TimeslipDefines.hpp"
+
+#include "Containers\Vector.hpp"
+
+constexpr U32 TILE_ENTITY_NONE = U32_MAX;
+constexpr U32 TILE_ENTITY_SLOT_BITS = 24; //Handles are the type above the slot in its type's array
+constexpr U32 TILE_ENTITY_MIN_TABLE = 256;
+constexpr U32 CHEST_SLOTS = 16;
+constexpr U16 FURNACE_SMELT_TICKS = 300;
+
+enum TileEntityType : U8
+{
+	TILE_ENTITY_CHEST,
+	TILE_ENTITY_TORCH,
+	TILE_ENTITY_FURNACE,
+
+	TILE_ENTITY_TYPE_COUNT
+};
+
+struct ChestState
+{
+	U16 items[CHEST_SLOTS];
+	U8 counts[CHEST_SLOTS];
+};
+
+struct TorchState
+{
+	U16 fuel; //Ticks left, the torch goes out at 0
+};
+
+struct FurnaceState
+{
+	U16 input;
+	U16 output;
+	U16 fuel;
+	U16 progress;
+};
+
+struct TileEntity
+{
+	U32 position; //Packed tile coordinate, x in the low 16 bits
+	U32 chunkPrevious; //Handles of the neighbours in this chunk's list
+	U32 chunkNext;
+	TileEntityType type;
+
+	union
+	{
+		ChestState chest;
+		TorchState torch;
+		FurnaceState furnace;
+	};
+};
+
+/// <summary>
+/// Open addressing slot, key is U32_MAX when empty
+/// </summary>
+struct TileEntitySlot
+{
+	U32 key;
+	U32 handle;
+};
+
+/*
+* Per-tile state for interactive tiles like chests, torches and furnaces, too big for Tile
+*
+* Each type keeps its tile entities packed in its own array so ticking walks one type at a time, removing one swaps
+* the last in its place. A linear probing table maps packed tile coordinates to handles and a second one maps a chunk
+* index to the head of a list running through that chunk's tile entities, neither holds anything for empty tiles or
+* chunks. Removal shifts later probes back instead of leaving tombstones
+*
+* Pointers returned by Create and Get are only good until the next Create or Destroy
+*/
+class TileEntities
+{
+public:
+	static TileEntity* Create(I32 x, I32 y, TileEntityType type);
+	static TileEntity* Get(I32 x, I32 y);
+	static bool Destroy(I32 x, I32 y);
+	static void Clear();
+
+	template <class Func> static void ForEachInChunk(U32 chunkIndex, Func&& func); //func(TileEntity& tileEntity), for drawing and saving a chunk
+	static U32 Count();
+	static U32 Count(TileEntityType type);
+
+	static U32 Pack(I32 x, I32 y);
+
+private:
+	static void Shutdown();
+	static void Update();
+	static void TickTorches();
+	static void TickFurnaces();
+
+	static TileEntity& Resolve(U32 handle);
+	static U32 ChunkOf(U32 position);
+	static U32 ChunkHead(U32 chunkIndex);
+	static void SetChunkHead(U32 chunkIndex, U32 handle);
+	static void Relink(const TileEntity& tileEntity, U32 handle);
+
+	static U32 FindSlot(const Vector<TileEntitySlot>& table, U32 key);
+	static void InsertSlot(Vector<TileEntitySlot>& table, U32& count, U32 key, U32 handle);
+	static void EraseSlot(Vector<TileEntitySlot>& table, U32& count, U32 slot);
+
+	static Vector<TileEntity> entities[TILE_ENTITY_TYPE_COUNT];
+	static Vector<TileEntitySlot> positions;
+	static Vector<TileEntitySlot> chunks;
+	static U32 positionCount;
+	static U32 chunkCount;
+
+	STATIC_CLASS(TileEntities);
+	friend class World;
+	friend class Benchmarks;
+};
+
+template <class Func> inline void TileEntities::ForEachInChunk(U32 chunkIndex, Func&& func)
+{
+	for (U32 handle = ChunkHead(chunkIndex); handle != TILE_ENTITY_NONE;)
+	{
+		TileEntity& tileEntity = Resolve(handle);
+		handle = tileEntity.chunkNext;
+
+		func(tileEntity);
+	}
+}
\ No newline at end of file
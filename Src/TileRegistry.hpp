@@ -0,0 +1,116 @@
+#pragma once
+
+#include "Defines.hpp"
+
+#include "Tile.hpp"
+
+enum TileTick : U8
+{
+	TILE_TICK_NONE,
+	TILE_TICK_GRASS,
+
+	TILE_TICK_COUNT
+};
+
+struct TileType
+{
+	const char* texture;
+	U32 mapColor; //0xAABBGGRR
+	bool solid; //Stops bodies, light and liquid, holds up falling blocks
+	bool falls;
+	U8 light; //Block light emitted, 0 for none
+	U8 hardness;
+	TileTick tick; //Random tick rule
+	bool grassy; //Grass can spread onto it
+};
+
+//Ids are the index in each layer's list, U8_MAX is always empty
+inline constexpr TileType WALL_TYPES[]{
+	{ "textures/GrasslandDirtWall.nhtex",	0xFF1A2D42, false, false, 0, 1, TILE_TICK_NONE, false },
+};
+
+inline constexpr TileType BLOCK_TYPES[]{
+	{ "textures/GrasslandDirt.nhtex",		0xFF2B4A6B, true, false, 0, 2, TILE_TICK_NONE, true },
+};
+
+inline constexpr TileType DECORATION_TYPES[]{
+	{ "textures/GrasslandGrass.nhtex",		0xFF3CA050, false, false, 0, 0, TILE_TICK_GRASS, false },
+	{ "textures/MesaGrass.nhtex",			0xFF3C78B4, false, false, 0, 0, TILE_TICK_GRASS, false },
+	{ "textures/DesertGrass.nhtex",			0xFF6EC8D2, false, false, 0, 0, TILE_TICK_GRASS, false },
+	{ "textures/MarshGrass.nhtex",			0xFF467850, false, false, 0, 0, TILE_TICK_GRASS, false },
+	{ "textures/JungleGrass.nhtex",			0xFF28A028, false, false, 0, 0, TILE_TICK_GRASS, false },
+};
+
+constexpr U16 TILE_TEXTURE_COUNT = (U16)(CountOf(WALL_TYPES) + CountOf(BLOCK_TYPES) + CountOf(DECORATION_TYPES));
+constexpr U16 TILE_TEXTURE_NONE = TILE_TEXTURE_COUNT; //Texture slot of every empty id
+
+/// <summary>
+/// One layer's tile types as arrays covering every id, so lookups never check for U8_MAX
+/// </summary>
+struct TileLayerTable
+{
+	U16 texture[U8_MAX + 1]; //Slot in the loaded texture list
+	U32 mapColor[U8_MAX + 1];
+	bool solid[U8_MAX + 1];
+	bool falls[U8_MAX + 1];
+	U8 light[U8_MAX + 1];
+	U8 hardness[U8_MAX + 1];
+	TileTick tick[U8_MAX + 1];
+	bool grassy[U8_MAX + 1];
+};
+
+template<U64 Count> constexpr TileLayerTable MakeLayerTable(const TileType(&types)[Count], U16 firstTexture)
+{
+	static_assert(Count < U8_MAX, "U8_MAX is reserved for empty tiles");
+
+	TileLayerTable table{};
+
+	for (U32 id = 0; id <= U8_MAX; ++id)
+	{
+		if (id < Count)
+		{
+			table.texture[id] = (U16)(firstTexture + id);
+			table.mapColor[id] = types[id].mapColor;
+			table.solid[id] = types[id].solid;
+			table.falls[id] = types[id].falls;
+			table.light[id] = types[id].light;
+			table.hardness[id] = types[id].hardness;
+			table.tick[id] = types[id].tick;
+			table.grassy[id] = types[id].grassy;
+		}
+		else
+		{
+			table.texture[id] = TILE_TEXTURE_NONE;
+			table.tick[id] = TILE_TICK_NONE;
+		}
+	}
+
+	return table;
+}
+
+//Indexed by TileLayer, texture slots run through walls, then blocks, then decorations
+inline constexpr TileLayerTable TILE_LAYERS[]{
+	MakeLayerTable(WALL_TYPES, 0),
+	MakeLayerTable(BLOCK_TYPES, (U16)CountOf(WALL_TYPES)),
+	MakeLayerTable(DECORATION_TYPES, (U16)(CountOf(WALL_TYPES) + CountOf(BLOCK_TYPES))),
+};
+
+inline constexpr const TileLayerTable& WALLS = TILE_LAYERS[TILE_LAYER_WALL];
+inline constexpr const TileLayerTable& BLOCKS = TILE_LAYERS[TILE_LAYER_BLOCK];
+inline constexpr const TileLayerTable& DECORATIONS = TILE_LAYERS[TILE_LAYER_DECORATION];
+
+/// <summary>
+/// Texture path of a texture slot, in the order of TILE_LAYERS
+/// </summary>
+constexpr const char* TileTexture(U16 slot)
+{
+	if (slot < CountOf(WALL_TYPES)) { return WALL_TYPES[slot].texture; }
+	slot -= (U16)CountOf(WALL_TYPES);
+
+	if (slot < CountOf(BLOCK_TYPES)) { return BLOCK_TYPES[slot].texture; }
+	slot -= (U16)CountOf(BLOCK_TYPES);
+
+	return DECORATION_TYPES[slot].texture;
+}
+
+static_assert(BLOCKS.texture[U8_MAX] == TILE_TEXTURE_NONE && !BLOCKS.solid[U8_MAX], "Empty ids have no texture and aren't solid");
\ No newline at end of file
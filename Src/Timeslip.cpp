@@ -11,6 +11,10 @@
 #include "Platform\Input.hpp"
 
 #include "World.hpp"
+#include "TileRegistry.hpp"
+#include "Benchmarks.hpp"
+#include "Entities.hpp"
+#include "SpatialGrid.hpp"
 
 Shader* Timeslip::tileShader;
 Pipeline* Timeslip::tilePipeline;
@@ -20,28 +24,11 @@ Buffer Timeslip::stagingBuffer;
 
 Scene* Timeslip::gameScene;
 
-String wallTextureNames[]{
-	"textures/GrasslandDirtWall.nhtex",
-};
-
-String blockTextureNames[]{
-	"textures/GrasslandDirt.nhtex",
-};
-
-String decorationTextureNames[]{
-	"textures/GrasslandGrass.nhtex",
-	"textures/MesaGrass.nhtex",
-	"textures/DesertGrass.nhtex",
-	"textures/MarshGrass.nhtex",
-	"textures/JungleGrass.nhtex",
-};
-
 String maskNames[]{
 	"textures/TileMask.nhtex"
 };
 
-//TODO: Type Traits to automate this
-U32 textureIndices[3][Math::Max(CountOf(decorationTextureNames), Math::Max(CountOf(blockTextureNames), CountOf(wallTextureNames)))];
+U32 textureIndices[TILE_TEXTURE_COUNT + 1]; //By texture slot, the last one is for empty tiles
 U32 maskIndices[CountOf(maskNames)];
 
 bool Timeslip::Initialize()
@@ -95,16 +82,10 @@ bool Timeslip::Initialize()
 
 	//Resources::UploadTexture("TileMask.bmp", upload);
 
-	U32 i = 0;
-	for (const String& name : wallTextureNames) { textureIndices[0][i++] = (U32)Resources::LoadTexture(name)->handle; }
-	
-	i = 0;
-	for (const String& name : blockTextureNames) { textureIndices[1][i++] = (U32)Resources::LoadTexture(name)->handle; }
+	for (U16 slot = 0; slot < TILE_TEXTURE_COUNT; ++slot) { textureIndices[slot] = (U32)Resources::LoadTexture(TileTexture(slot))->handle; }
+	textureIndices[TILE_TEXTURE_NONE] = U16_MAX;
 	
-	i = 0;
-	for (const String& name : decorationTextureNames) { textureIndices[2][i++] = (U32)Resources::LoadTexture(name)->handle; }
-	
-	i = 0;
+	U32 i = 0;
 	for (const String& name : maskNames) { maskIndices[i++] = (U32)Resources::LoadTexture(name)->handle; }
 	
 	U32 indices[]{ 0, 2, 1, 2, 3, 1,   4, 6, 5, 6, 7, 5,   8, 10, 9, 10, 11, 9,   12, 14, 13, 14, 15, 13,   16, 18, 17, 18, 19, 17 };
@@ -158,6 +139,10 @@ bool Timeslip::Initialize()
 	tilePipeline->UploadDrawCall(6, 6, 0, VIEW_CHUNKS_X * VIEW_CHUNKS_Y * CHUNK_TILE_COUNT, VIEW_CHUNKS_X * VIEW_CHUNKS_Y * CHUNK_TILE_COUNT);
 	tilePipeline->UploadDrawCall(6, 12, 0, VIEW_CHUNKS_X * VIEW_CHUNKS_Y * CHUNK_TILE_COUNT, VIEW_CHUNKS_X * VIEW_CHUNKS_Y * CHUNK_TILE_COUNT * 2);
 	
+#ifdef TIMESLIP_BENCHMARKS
+	Benchmarks::Run();
+#endif
+
 	stagingBuffer = Renderer::CreateBuffer(sizeof(TileInstance) * CHUNK_INSTANCE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y, BUFFER_USAGE_TRANSFER_SRC, BUFFER_MEMORY_TYPE_CPU_VISIBLE | BUFFER_MEMORY_TYPE_CPU_COHERENT);
 	
 	World::Initialize((TileInstance*)stagingBuffer.data, WORLD_SIZE_LARGE);
@@ -168,17 +153,13 @@ bool Timeslip::Initialize()
 void Timeslip::Shutdown()
 {
 	World::Shutdown();
+	Entities::Shutdown();
+	SpatialGrid::Shutdown();
 
 	tilePipelineGraph.Destroy();
 
 	Renderer::DestroyBuffer(stagingBuffer);
 
-	for (String& string : wallTextureNames) { string.Destroy(); }
-	
-	for (String& string : blockTextureNames) { string.Destroy(); }
-	
-	for (String& string : decorationTextureNames) { string.Destroy(); }
-
 	for (String& string : maskNames) { string.Destroy(); }
 }
 
@@ -199,9 +180,7 @@ void Timeslip::UpdateTiles(U32 writeCount, BufferCopy* writes)
 
 U32 Timeslip::GetTextureIndex(U32 type, U32 id)
 {
-	if (id == 255) { return U16_MAX; }
-
-	return textureIndices[type][id];
+	return textureIndices[TILE_LAYERS[type].texture[id]];
 }
 
 U32 Timeslip::GetMaskIndex(U32 type)
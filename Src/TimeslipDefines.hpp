@@ -3,6 +3,8 @@
 #include "Defines.hpp"
 #include "Math\Math.hpp"
 
+//#define TIMESLIP_BENCHMARKS //Runs Benchmarks::Run on startup and logs the results
+
 enum WorldSize
 {
 	WORLD_SIZE_TEST = 280,
@@ -26,9 +28,34 @@ constexpr I64 VIEW_OFFSET_Y = VIEW_CHUNKS_Y / 2;
 constexpr I64 CHUNK_SIZE = 8;
 constexpr I64 CHUNK_TILE_COUNT = CHUNK_SIZE * CHUNK_SIZE;
 constexpr I64 CHUNK_INSTANCE_COUNT = CHUNK_TILE_COUNT * 3;
+constexpr I64 CHUNK_SHIFT = 3;
+constexpr I64 CHUNK_MASK = CHUNK_SIZE - 1;
+
+constexpr F64 TICK_TIME = 1.0 / 30.0;
+constexpr U32 MAX_TICKS_PER_FRAME = 4;
 
 constexpr I64 MAX_SEED = 90000000000; //9000000000000000
 
+/// <summary>
+/// Index of the lowest set bit, mask must not be zero
+/// </summary>
+inline U64 FirstSetBit(U64 mask) { return _tzcnt_u64(mask); }
+
+/// <summary>
+/// Index of the highest set bit, mask must not be zero
+/// </summary>
+inline U64 LastSetBit(U64 mask) { return 63 - __lzcnt64(mask); }
+
+/// <summary>
+/// Number of set bits in mask
+/// </summary>
+inline U64 BitCount(U64 mask) { return __popcnt64(mask); }
+
+/// <summary>
+/// Bit of a tile inside its chunk's 64-bit mask, one bit per tile, row-major from the bottom left
+/// </summary>
+inline U64 ChunkBit(U32 x, U32 y) { return 1ull << ((x & CHUNK_MASK) | ((y & CHUNK_MASK) << CHUNK_SHIFT)); }
+
 struct TileVertex
 {
 	Vector3 position;
@@ -7,9 +7,22 @@
 #include "Resources\Settings.hpp"
 #include "Rendering\Pipeline.hpp"
 #include "Platform\Input.hpp"
+#include "Platform\Jobs.hpp"
 
 #include "Tile.hpp"
+#include "TileRegistry.hpp"
 #include "Chunk.hpp"
+#include "Liquid.hpp"
+#include "Lighting.hpp"
+#include "Snapshots.hpp"
+#include "History.hpp"
+#include "Pathfinding.hpp"
+#include "Collision.hpp"
+#include "RandomTicks.hpp"
+#include "FallingTiles.hpp"
+#include "TileEntities.hpp"
+#include "Minimap.hpp"
+#include "Exploration.hpp"
 #include "Timeslip.hpp"
 
 I64 World::SEED;
@@ -17,6 +30,8 @@ I16 World::TILE_COUNT_X;
 I16 World::TILE_COUNT_Y;
 I16 World::TILE_OFFSET_X;
 I16 World::TILE_OFFSET_Y;
+I16 World::CHUNK_COUNT_X;
+I16 World::CHUNK_COUNT_Y;
 I16 World::FIRST_CHUNK_X;
 I16 World::LAST_CHUNK_X;
 I16 World::FIRST_CHUNK_Y;
@@ -25,30 +40,54 @@ I16 World::LAST_CHUNK_Y;
 Vector2Int World::chunkPos = Vector2IntZero;
 Vector2Int World::prevChunkPos = Vector2IntZero;
 
+U64 World::tick{ 0 };
+F64 World::tickTimer{ 0.0 };
+F64 World::playbackRate{ 0.0 };
+F64 World::playbackTimer{ 0.0 };
+
 TileInstance* World::wallInstances;
 TileInstance* World::blockInstances;
 TileInstance* World::decorationInstances;
 Tile* World::tiles{ nullptr };
+U64* World::dirtyChunks{ nullptr };
+U64* World::editedChunks{ nullptr };
 Chunk World::chunks[VIEW_CHUNKS_X * VIEW_CHUNKS_Y];
 U16 World::leftIndex{ 0 };
 U16 World::rightIndex{ VIEW_CHUNKS_X - 1 };
 U16 World::bottomIndex{ 0 };
 U16 World::topIndex{ VIEW_CHUNKS_Y - 1 };
 
+//Narrows [enter, exit] to where a ray is inside [0, size) on one axis, enter is also returned on its own
+static bool ClipRay(F32 origin, F32 direction, F32 size, F32& enter, F32& exit, F32& axisEnter)
+{
+	axisEnter = 0.0f;
+
+	if (direction == 0.0f) { return origin >= 0.0f && origin < size; }
+
+	F32 t0 = -origin / direction;
+	F32 t1 = (size - origin) / direction;
+	if (t0 > t1) { Swap(t0, t1); }
+
+	axisEnter = t0;
+	enter = Math::Max(enter, t0);
+	exit = Math::Min(exit, t1);
+
+	return enter <= exit;
+}
+
+//Distance along a ray to where it leaves cell on one axis
+static F32 NextBoundary(I32 cell, I32 step, F32 origin, F32 direction)
+{
+	if (direction == 0.0f) { return F32_MAX; }
+
+	return ((step > 0 ? cell + 1 : cell) - origin) / direction;
+}
+
 bool World::Initialize(TileInstance* instanceBuffer, WorldSize size)
 {
 	SEED = -88579424064;//GenerateSeed();
 
-	TILE_COUNT_X = (U16)size;
-	TILE_COUNT_Y = (U16)(TILE_COUNT_X / 3.5f);
-	TILE_OFFSET_X = TILE_COUNT_X / 2;
-	TILE_OFFSET_Y = TILE_COUNT_Y / 2;
-	FIRST_CHUNK_X = -TILE_OFFSET_X / CHUNK_SIZE + VIEW_OFFSET_X;
-	LAST_CHUNK_X = TILE_OFFSET_X / CHUNK_SIZE - VIEW_OFFSET_X;
-	FIRST_CHUNK_Y = -TILE_OFFSET_Y / CHUNK_SIZE + VIEW_OFFSET_Y;
-	LAST_CHUNK_Y = TILE_OFFSET_Y / CHUNK_SIZE - VIEW_OFFSET_Y;
-
-	if (!tiles) { Memory::AllocateStaticArray(&tiles, TOTAL_TILE_COUNT); }
+	Resize(size);
 
 	blockInstances = instanceBuffer;
 	wallInstances = instanceBuffer + CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
@@ -56,6 +95,15 @@ bool World::Initialize(TileInstance* instanceBuffer, WorldSize size)
 
 	GenerateWorld();
 
+	Liquid::Reset();
+	Lighting::Reset();
+	Lighting::Relight();
+	Pathfinding::Build();
+	Collision::Build();
+	FallingTiles::Build();
+	Minimap::Build();
+	Snapshots::Capture();
+
 	Vector2Int position = { -VIEW_OFFSET_X, -VIEW_OFFSET_Y };
 
 	U32 i = 0;
@@ -80,7 +128,13 @@ bool World::Initialize(TileInstance* instanceBuffer, WorldSize size)
 
 void World::Shutdown()
 {
-
+	Liquid::Shutdown();
+	Lighting::Shutdown();
+	Snapshots::Shutdown();
+	History::Shutdown();
+	Pathfinding::Shutdown();
+	FallingTiles::Shutdown();
+	TileEntities::Shutdown();
 }
 
 void World::Update(Camera& camera)
@@ -114,12 +168,31 @@ void World::Update(Camera& camera)
 		camera.SetPosition(camera.Position().Clamped({ -TILE_OFFSET_X * 3 + 120.0f, -TILE_OFFSET_Y * 3 + 67.5f, 0.0f }, { TILE_OFFSET_X * 3 - 120.0f, TILE_OFFSET_Y * 3 - 67.5f, 0.0f }));
 	}
 
+	if (playbackRate != 0.0) { Playback(); }
+	else
+	{
+		tickTimer += Time::DeltaTime();
+
+		U32 tickCount = 0;
+		while (tickTimer >= TICK_TIME && tickCount < MAX_TICKS_PER_FRAME)
+		{
+			Tick();
+			tickTimer -= TICK_TIME;
+			++tickCount;
+		}
+
+		if (tickCount == MAX_TICKS_PER_FRAME) { tickTimer = 0.0; } //Drop the backlog instead of spiraling
+	}
+
 	Vector3 pos = -camera.Position() / 24;
 	if (pos.x < 0.0f) { pos.x -= 1.0f; }
 	if (pos.y < 0.0f) { pos.y -= 1.0f; }
 	chunkPos = Vector2Int{ (I32)pos.x, (I32)pos.y }.Clamped({ FIRST_CHUNK_X, FIRST_CHUNK_Y }, { LAST_CHUNK_X, LAST_CHUNK_Y });
 
-	BufferCopy writes[(VIEW_CHUNKS_X + VIEW_CHUNKS_Y) * 3];
+	Exploration::Reveal((chunkPos.x + CHUNK_COUNT_X / 2) * CHUNK_SIZE + CHUNK_SIZE / 2, (chunkPos.y + CHUNK_COUNT_Y / 2) * CHUNK_SIZE + CHUNK_SIZE / 2, EXPLORE_RADIUS);
+
+	//Every visible chunk is written at most once a frame, loading clears its dirty bit so UploadDirtyChunks skips it
+	BufferCopy writes[VIEW_CHUNKS_X * VIEW_CHUNKS_Y * 3];
 	U32 writeCount = 0;
 
 	//TODO: Edge case of moving multiple chunks in one frame
@@ -127,26 +200,18 @@ void World::Update(Camera& camera)
 	if (chunkPos != prevChunkPos)
 	{
 		bool loadHorizontal = false;
+		U16 loadedColumn = U16_MAX; //The corner of a diagonal move loads twice but only needs the one write
 
 		if (chunkPos.x > prevChunkPos.x) //Unload left, load right
 		{
 			loadHorizontal = true;
+			loadedColumn = leftIndex;
 			Chunk* chunk = chunks + leftIndex;
 
 			for (U32 y = 0; y < VIEW_CHUNKS_Y; ++y)
 			{
 				chunk->Load(1);
-
-				BufferCopy write{};
-				write.srcOffset = sizeof(TileInstance) * chunk->offset;
-				write.dstOffset = write.srcOffset;
-				write.size = sizeof(TileInstance) * CHUNK_TILE_COUNT;
-
-				writes[writeCount++] = write;
-				write.dstOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
-				writes[writeCount++] = write;
-				write.dstOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
-				writes[writeCount++] = write;
+				AddChunkWrites(chunk, writes, writeCount);
 
 				chunk += VIEW_CHUNKS_X;
 			}
@@ -157,22 +222,13 @@ void World::Update(Camera& camera)
 		else if (chunkPos.x < prevChunkPos.x) //Unload right, load left
 		{
 			loadHorizontal = true;
+			loadedColumn = rightIndex;
 			Chunk* chunk = chunks + rightIndex;
 
 			for (U32 y = 0; y < VIEW_CHUNKS_Y; ++y)
 			{
 				chunk->Load(0);
-
-				BufferCopy write{};
-				write.srcOffset = sizeof(TileInstance) * chunk->offset;
-				write.dstOffset = write.srcOffset;
-				write.size = sizeof(TileInstance) * CHUNK_TILE_COUNT;
-
-				writes[writeCount++] = write;
-				write.dstOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
-				writes[writeCount++] = write;
-				write.dstOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
-				writes[writeCount++] = write;
+				AddChunkWrites(chunk, writes, writeCount);
 
 				chunk += VIEW_CHUNKS_X;
 			}
@@ -190,17 +246,7 @@ void World::Update(Camera& camera)
 			for (U32 x = 0; x < VIEW_CHUNKS_X; ++x)
 			{
 				chunk->Load(2);
-
-				BufferCopy write{};
-				write.srcOffset = sizeof(TileInstance) * chunk->offset;
-				write.dstOffset = write.srcOffset;
-				write.size = sizeof(TileInstance) * CHUNK_TILE_COUNT;
-
-				writes[writeCount++] = write;
-				write.dstOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
-				writes[writeCount++] = write;
-				write.dstOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
-				writes[writeCount++] = write;
+				if (x != loadedColumn) { AddChunkWrites(chunk, writes, writeCount); }
 
 				++chunk;
 			}
@@ -217,17 +263,7 @@ void World::Update(Camera& camera)
 			for (U32 x = 0; x < VIEW_CHUNKS_X; ++x)
 			{
 				chunk->Load(3);
-
-				BufferCopy write{};
-				write.srcOffset = sizeof(TileInstance) * chunk->offset;
-				write.dstOffset = write.srcOffset;
-				write.size = sizeof(TileInstance) * CHUNK_TILE_COUNT;
-
-				writes[writeCount++] = write;
-				write.dstOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
-				writes[writeCount++] = write;
-				write.dstOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
-				writes[writeCount++] = write;
+				if (x != loadedColumn) { AddChunkWrites(chunk, writes, writeCount); }
 
 				++chunk;
 			}
@@ -235,14 +271,101 @@ void World::Update(Camera& camera)
 			if (--bottomIndex == U16_MAX) { bottomIndex = VIEW_CHUNKS_Y - 1; }
 			if (--topIndex == U16_MAX) { topIndex = VIEW_CHUNKS_Y - 1; }
 		}
+	}
+
+	UploadDirtyChunks(writes, writeCount);
+
+	if (writeCount)
+	{
+		Timeslip::UpdateTiles(writeCount, writes);
+	}
+
+	Minimap::Update();
+
+	prevChunkPos = chunkPos;
+}
+
+void World::Tick()
+{
+	++tick;
+
+	FallingTiles::Update();
+	Liquid::Update();
+	RandomTicks::Update();
+	TileEntities::Update();
+	Pathfinding::Update();
+	History::EndTick();
+
+	if (tick % SNAPSHOT_INTERVAL == 0) { Snapshots::Capture(); }
+}
+
+void World::Playback()
+{
+	playbackTimer += Time::DeltaTime() * Math::Abs(playbackRate);
+
+	while (playbackTimer >= 1.0)
+	{
+		playbackTimer -= 1.0;
+
+		if (!(playbackRate > 0.0 ? History::StepForward() : History::StepBackward()))
+		{
+			playbackTimer = 0.0;
+			break;
+		}
+	}
+}
+
+void World::UploadDirtyChunks(BufferCopy* writes, U32& writeCount)
+{
+	for (Chunk& chunk : chunks)
+	{
+		U32 index = ChunkIndex(&chunk);
 
-		if (writeCount)
+		if (dirtyChunks[index >> 6] & (1ull << (index & 63)))
 		{
-			Timeslip::UpdateTiles(writeCount, writes);
+			chunk.LoadTiles();
+			AddChunkWrites(&chunk, writes, writeCount);
 		}
 	}
+}
 
-	prevChunkPos = chunkPos;
+void World::AddChunkWrites(const Chunk* chunk, BufferCopy* writes, U32& writeCount)
+{
+	BufferCopy write{};
+	write.srcOffset = sizeof(TileInstance) * chunk->offset;
+	write.dstOffset = write.srcOffset;
+	write.size = sizeof(TileInstance) * CHUNK_TILE_COUNT;
+
+	writes[writeCount++] = write;
+	write.srcOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
+	write.dstOffset = write.srcOffset;
+	writes[writeCount++] = write;
+	write.srcOffset += sizeof(TileInstance) * CHUNK_TILE_COUNT * VIEW_CHUNKS_X * VIEW_CHUNKS_Y;
+	write.dstOffset = write.srcOffset;
+	writes[writeCount++] = write;
+}
+
+void World::DirtyTile(U32 index)
+{
+	DirtyChunk(ChunkIndex(index));
+}
+
+void World::DirtyTileRender(U32 index)
+{
+	U32 chunkIndex = ChunkIndex(index);
+	dirtyChunks[chunkIndex >> 6] |= 1ull << (chunkIndex & 63);
+}
+
+void World::DirtyChunk(U32 chunkIndex)
+{
+	dirtyChunks[chunkIndex >> 6] |= 1ull << (chunkIndex & 63);
+	editedChunks[chunkIndex >> 6] |= 1ull << (chunkIndex & 63);
+	Minimap::DirtyChunk(chunkIndex);
+}
+
+void World::DirtyAll()
+{
+	Memory::Set(dirtyChunks, U8_MAX, sizeof(U64) * (TOTAL_CHUNK_COUNT / 64 + 1));
 }
 
 Tile* World::GetTile(I16 x, I16 y)
@@ -255,11 +378,242 @@ Tile* World::GetTile(I16 x, I16 y)
 	return tiles + x + TILE_COUNT_X * y;
 }
 
+void World::SetTile(U32 index, U8 layer, U8 value)
+{
+	if (tiles[index][layer] == value) { return; }
+
+	Tile tile = tiles[index];
+	tile[layer] = value;
+
+	ReplaceTile(index, tile);
+}
+
+void World::ReplaceTile(U32 index, const Tile& tile)
+{
+	Tile previous = tiles[index];
+	tiles[index] = tile;
+
+	History::Record(index, previous, tile);
+
+	if (previous.block != tile.block)
+	{
+		Pathfinding::Invalidate(index);
+		Collision::SetSolid(index, BLOCKS.solid[tile.block]);
+		FallingTiles::Disturb(index, tile.block);
+	}
+
+	Lighting::TileChanged(index, previous);
+
+	if (BLOCKS.light[tile.block] != BLOCKS.light[previous.block])
+	{
+		if (BLOCKS.light[tile.block]) { Lighting::AddSource(index, BLOCKS.light[tile.block]); }
+		else { Lighting::RemoveSource(index); }
+	}
+
+	//Neighbours are redrawn too since their masks depend on this tile
+	I32 x = index % TILE_COUNT_X;
+	I32 y = index / TILE_COUNT_X;
+
+	DirtyTile(index);
+	Liquid::Wake(index);
+
+	if (x > 0) { DirtyTile(index - 1); Liquid::Wake(index - 1); }
+	if (x < TILE_COUNT_X - 1) { DirtyTile(index + 1); Liquid::Wake(index + 1); }
+	if (y > 0) { DirtyTile(index - TILE_COUNT_X); }
+	if (y < TILE_COUNT_Y - 1) { DirtyTile(index + TILE_COUNT_X); Liquid::Wake(index + TILE_COUNT_X); }
+}
+
+bool World::Raycast(const Vector2& origin, const Vector2& direction, F32 maxDistance, RaycastHit& hit)
+{
+	hit.index = U32_MAX;
+
+	//Tile space, tiles are square so distances only need scaling
+	F32 originX = origin.x / TILE_WIDTH + TILE_OFFSET_X;
+	F32 originY = origin.y / TILE_HEIGHT + TILE_OFFSET_Y;
+
+	//Clip to the world first so the walk never needs a bounds check until it leaves
+	F32 t = 0.0f;
+	F32 exit = maxDistance / TILE_WIDTH;
+	F32 enterX, enterY;
+
+	if (!ClipRay(originX, direction.x, TILE_COUNT_X, t, exit, enterX) || !ClipRay(originY, direction.y, TILE_COUNT_Y, t, exit, enterY)) { return false; }
+
+	I32 stepX = direction.x > 0.0f ? 1 : -1;
+	I32 stepY = direction.y > 0.0f ? 1 : -1;
+
+	Vector2 normal = Vector2Zero;
+	if (t > 0.0f) { normal = enterX > enterY ? Vector2{ (F32)-stepX, 0.0f } : Vector2{ 0.0f, (F32)-stepY }; }
+
+	I32 x = Math::Clamp((I32)Math::Floor(originX + direction.x * t), 0, TILE_COUNT_X - 1);
+	I32 y = Math::Clamp((I32)Math::Floor(originY + direction.y * t), 0, TILE_COUNT_Y - 1);
+
+	F32 nextX = NextBoundary(x, stepX, originX, direction.x);
+	F32 nextY = NextBoundary(y, stepY, originY, direction.y);
+	F32 deltaX = direction.x != 0.0f ? 1.0f / Math::Abs(direction.x) : F32_MAX;
+	F32 deltaY = direction.y != 0.0f ? 1.0f / Math::Abs(direction.y) : F32_MAX;
+
+	while (true)
+	{
+		U64 solid = Collision::solidMasks[(x >> CHUNK_SHIFT) + (y >> CHUNK_SHIFT) * CHUNK_COUNT_X];
+
+		if (!solid)
+		{
+			//Empty chunk, jump straight to where the ray leaves it
+			I32 chunkLeft = x & ~(I32)CHUNK_MASK;
+			I32 chunkBottom = y & ~(I32)CHUNK_MASK;
+			F32 exitX = NextBoundary(stepX > 0 ? chunkLeft + (I32)CHUNK_MASK : chunkLeft, stepX, originX, direction.x);
+			F32 exitY = NextBoundary(stepY > 0 ? chunkBottom + (I32)CHUNK_MASK : chunkBottom, stepY, originY, direction.y);
+
+			if (exitX < exitY)
+			{
+				t = exitX;
+				x = stepX > 0 ? chunkLeft + (I32)CHUNK_SIZE : chunkLeft - 1;
+				y = Math::Clamp((I32)Math::Floor(originY + direction.y * t), chunkBottom, chunkBottom + (I32)CHUNK_MASK);
+				normal = { (F32)-stepX, 0.0f };
+			}
+			else
+			{
+				t = exitY;
+				y = stepY > 0 ? chunkBottom + (I32)CHUNK_SIZE : chunkBottom - 1;
+				x = Math::Clamp((I32)Math::Floor(originX + direction.x * t), chunkLeft, chunkLeft + (I32)CHUNK_MASK);
+				normal = { 0.0f, (F32)-stepY };
+			}
+
+			nextX = NextBoundary(x, stepX, originX, direction.x);
+			nextY = NextBoundary(y, stepY, originY, direction.y);
+		}
+		else if (solid & ChunkBit(x, y))
+		{
+			hit.index = TileIndex(x, y);
+			hit.distance = t * TILE_WIDTH;
+			hit.point = origin + direction * hit.distance;
+			hit.normal = normal;
+			return true;
+		}
+		else if (nextX < nextY)
+		{
+			t = nextX;
+			x += stepX;
+			nextX += deltaX;
+			normal = { (F32)-stepX, 0.0f };
+		}
+		else
+		{
+			t = nextY;
+			y += stepY;
+			nextY += deltaY;
+			normal = { 0.0f, (F32)-stepY };
+		}
+
+		if (t > exit || x < 0 || x >= TILE_COUNT_X || y < 0 || y >= TILE_COUNT_Y) { return false; }
+	}
+}
+
+void World::RaycastBatch(const Ray* rays, RaycastHit* hits, U32 count)
+{
+	Jobs::Dispatch(count, 64, [rays, hits](JobDispatchArgs args) {
+		const Ray& ray = rays[args.jobIndex];
+		Raycast(ray.origin, ray.direction, ray.maxDistance, hits[args.jobIndex]);
+	});
+
+	Jobs::Wait();
+}
+
+void World::SetPlayback(F64 ticksPerSecond)
+{
+	playbackRate = ticksPerSecond;
+	playbackTimer = 0.0;
+	tickTimer = 0.0;
+}
+
 const I64& World::Seed()
 {
 	return SEED;
 }
 
+const U64& World::CurrentTick()
+{
+	return tick;
+}
+
+U32 World::TileIndex(I32 x, I32 y)
+{
+	return x + y * TILE_COUNT_X;
+}
+
+U32 World::ChunkIndex(U32 tileIndex)
+{
+	U32 x = tileIndex % TILE_COUNT_X;
+	U32 y = tileIndex / TILE_COUNT_X;
+
+	return (x >> CHUNK_SHIFT) + (y >> CHUNK_SHIFT) * CHUNK_COUNT_X;
+}
+
+U32 World::ChunkIndex(const Chunk* chunk)
+{
+	return ((chunk->position.x + TILE_OFFSET_X) >> CHUNK_SHIFT) + ((chunk->position.y + TILE_OFFSET_Y) >> CHUNK_SHIFT) * CHUNK_COUNT_X;
+}
+
+U32 World::FirstTile(U32 chunkIndex)
+{
+	U32 chunkX = chunkIndex % CHUNK_COUNT_X;
+	U32 chunkY = chunkIndex / CHUNK_COUNT_X;
+
+	return (chunkX << CHUNK_SHIFT) + (chunkY << CHUNK_SHIFT) * TILE_COUNT_X;
+}
+
+bool World::TileBounds(const Vector2& min, const Vector2& max, I32& left, I32& bottom, I32& right, I32& top)
+{
+	//Clamped to the world, an edge lying exactly on a tile boundary doesn't cover the tile past it
+	left = Math::Max((I32)Math::Floor(min.x / TILE_WIDTH + TILE_OFFSET_X + COLLISION_SKIN), 0);
+	bottom = Math::Max((I32)Math::Floor(min.y / TILE_HEIGHT + TILE_OFFSET_Y + COLLISION_SKIN), 0);
+	right = Math::Min((I32)Math::Floor(max.x / TILE_WIDTH + TILE_OFFSET_X - COLLISION_SKIN), TILE_COUNT_X - 1);
+	top = Math::Min((I32)Math::Floor(max.y / TILE_HEIGHT + TILE_OFFSET_Y - COLLISION_SKIN), TILE_COUNT_Y - 1);
+
+	return left <= right && bottom <= top;
+}
+
+void World::Resize(WorldSize size)
+{
+	//Both halves of the world are rounded down to whole chunks so the chunk grid lines up with the tile array
+	TILE_COUNT_X = (I16)(size / (CHUNK_SIZE * 2) * (CHUNK_SIZE * 2));
+	TILE_COUNT_Y = (I16)((I64)(size / 3.5f) / (CHUNK_SIZE * 2) * (CHUNK_SIZE * 2));
+	TILE_OFFSET_X = TILE_COUNT_X / 2;
+	TILE_OFFSET_Y = TILE_COUNT_Y / 2;
+	CHUNK_COUNT_X = TILE_COUNT_X / CHUNK_SIZE;
+	CHUNK_COUNT_Y = TILE_COUNT_Y / CHUNK_SIZE;
+	FIRST_CHUNK_X = -TILE_OFFSET_X / CHUNK_SIZE + VIEW_OFFSET_X;
+	LAST_CHUNK_X = TILE_OFFSET_X / CHUNK_SIZE - VIEW_OFFSET_X;
+	FIRST_CHUNK_Y = -TILE_OFFSET_Y / CHUNK_SIZE + VIEW_OFFSET_Y;
+	LAST_CHUNK_Y = TILE_OFFSET_Y / CHUNK_SIZE - VIEW_OFFSET_Y;
+
+	if (!tiles)
+	{
+		Memory::AllocateStaticArray(&tiles, TOTAL_TILE_COUNT);
+		Memory::AllocateStaticArray(&dirtyChunks, TOTAL_CHUNK_COUNT / 64 + 1);
+		Memory::AllocateStaticArray(&editedChunks, TOTAL_CHUNK_COUNT / 64 + 1);
+		Liquid::Initialize();
+		Lighting::Initialize();
+		Snapshots::Initialize();
+		Pathfinding::Initialize();
+		Collision::Initialize();
+		FallingTiles::Initialize();
+		Minimap::Initialize();
+		Exploration::Initialize();
+	}
+
+	Memory::Zero(dirtyChunks, sizeof(U64) * (TOTAL_CHUNK_COUNT / 64 + 1));
+	Memory::Zero(editedChunks, sizeof(U64) * (TOTAL_CHUNK_COUNT / 64 + 1));
+	tick = 0;
+	tickTimer = 0.0;
+	playbackRate = 0.0;
+	Snapshots::Reset();
+	History::Reset();
+	FallingTiles::Reset();
+	TileEntities::Clear();
+	Exploration::Reset();
+}
+
 void World::GenerateWorld()
 {
 	static constexpr CatmullRomSpline<F64> inlandness(-50.0, -50.0, -40.0, -30.0, -10.0, -5.0, 0.0, 5.0, 10.0, 15.0, 25.0, 35.0, 40.0, 40.0);
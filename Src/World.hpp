@@ -3,31 +3,76 @@
 #include "TimeslipDefines.hpp"
 #include "Containers\Freelist.hpp"
 
-struct Tile;
+#include "Tile.hpp"
+
 struct Chunk;
 struct Camera;
+struct BufferCopy;
+
+struct Ray
+{
+	Vector2 origin;
+	Vector2 direction; //Normalized
+	F32 maxDistance;
+};
+
+struct RaycastHit
+{
+	U32 index; //U32_MAX if nothing was hit
+	Vector2 point;
+	Vector2 normal;
+	F32 distance;
+};
 
 class World
 {
 public:
 	static Tile* GetTile(I16 x, I16 y);
+	static void SetTile(U32 index, U8 layer, U8 value);
+
+	static void DirtyTile(U32 index);
+	static void DirtyTileRender(U32 index); //Only redraws the chunk, for changes like light that aren't tile edits
+	static void DirtyChunk(U32 chunkIndex);
+	static void DirtyAll();
+
+	static bool Raycast(const Vector2& origin, const Vector2& direction, F32 maxDistance, RaycastHit& hit); //World units, stops at the first tile with a block
+	static void RaycastBatch(const Ray* rays, RaycastHit* hits, U32 count);
+	template <class Func> static void ForEachTile(const Vector2& min, const Vector2& max, Func&& func); //func(U32 index, Tile& tile) for each tile the box covers, a chunk at a time
+	template <class Func> static void ForEachTileInCircle(const Vector2& center, F32 radius, Func&& func); //Each tile whose center is inside the circle
+
+	static void SetPlayback(F64 ticksPerSecond); //Plays History instead of simulating, negative plays backward, 0 resumes
 
 	static const I64& Seed();
+	static const U64& CurrentTick();
 
 private:
 	static bool Initialize(TileInstance* instanceBuffer, WorldSize size);
 	static void Shutdown();
 
 	static void Update(Camera& camera);
+	static void Tick();
+	static void Playback();
+	static void UploadDirtyChunks(BufferCopy* writes, U32& writeCount);
+	static void AddChunkWrites(const Chunk* chunk, BufferCopy* writes, U32& writeCount);
+	static void ReplaceTile(U32 index, const Tile& tile);
 
+	static void Resize(WorldSize size);
 	static void GenerateWorld();
 	static I64 GenerateSeed();
 
+	static U32 TileIndex(I32 x, I32 y);
+	static U32 ChunkIndex(U32 tileIndex);
+	static U32 ChunkIndex(const Chunk* chunk);
+	static U32 FirstTile(U32 chunkIndex);
+	static bool TileBounds(const Vector2& min, const Vector2& max, I32& left, I32& bottom, I32& right, I32& top);
+
 	static I64 SEED;
 	static I16 TILE_COUNT_X;
 	static I16 TILE_COUNT_Y;
 	static I16 TILE_OFFSET_X;
 	static I16 TILE_OFFSET_Y;
+	static I16 CHUNK_COUNT_X;
+	static I16 CHUNK_COUNT_Y;
 	static I16 FIRST_CHUNK_X;
 	static I16 LAST_CHUNK_X;
 	static I16 FIRST_CHUNK_Y;
@@ -36,10 +81,17 @@ private:
 	static Vector2Int chunkPos;
 	static Vector2Int prevChunkPos;
 
+	static U64 tick;
+	static F64 tickTimer;
+	static F64 playbackRate;
+	static F64 playbackTimer;
+
 	static TileInstance* wallInstances;
 	static TileInstance* blockInstances;
 	static TileInstance* decorationInstances;
 	static Tile* tiles;
+	static U64* dirtyChunks;
+	static U64* editedChunks;
 	static Chunk chunks[];
 	static U16 leftIndex;
 	static U16 rightIndex;
@@ -48,5 +100,81 @@ private:
 
 	STATIC_CLASS(World);
 	friend class Timeslip;
+	friend class Benchmarks;
+	friend class Liquid;
+	friend class Lighting;
+	friend class Snapshots;
+	friend class History;
+	friend class Pathfinding;
+	friend class Collision;
+	friend class RandomTicks;
+	friend class FallingTiles;
+	friend class TileEntities;
+	friend class Minimap;
+	friend class Exploration;
 	friend struct Chunk;
-};
\ No newline at end of file
+};
+
+template <class Func>
+inline void World::ForEachTile(const Vector2& min, const Vector2& max, Func&& func)
+{
+	I32 left, bottom, right, top;
+	if (!TileBounds(min, max, left, bottom, right, top)) { return; }
+
+	for (I32 chunkY = bottom >> CHUNK_SHIFT; chunkY <= top >> CHUNK_SHIFT; ++chunkY)
+	{
+		I32 firstY = Math::Max(bottom, chunkY << CHUNK_SHIFT);
+		I32 lastY = Math::Min(top, (chunkY << CHUNK_SHIFT) + (I32)CHUNK_MASK);
+
+		for (I32 chunkX = left >> CHUNK_SHIFT; chunkX <= right >> CHUNK_SHIFT; ++chunkX)
+		{
+			I32 firstX = Math::Max(left, chunkX << CHUNK_SHIFT);
+			I32 lastX = Math::Min(right, (chunkX << CHUNK_SHIFT) + (I32)CHUNK_MASK);
+
+			for (I32 y = firstY; y <= lastY; ++y)
+			{
+				U32 index = TileIndex(firstX, y);
+				for (I32 x = firstX; x <= lastX; ++x, ++index) { func(index, tiles[index]); }
+			}
+		}
+	}
+}
+
+template <class Func>
+inline void World::ForEachTileInCircle(const Vector2& center, F32 radius, Func&& func)
+{
+	I32 left, bottom, right, top;
+	if (!TileBounds(center - radius, center + radius, left, bottom, right, top)) { return; }
+
+	//Tile space, shifted so tile x's center is at x
+	F32 centerX = center.x / TILE_WIDTH + TILE_OFFSET_X - 0.5f;
+	F32 centerY = center.y / TILE_HEIGHT + TILE_OFFSET_Y - 0.5f;
+	F32 radiusSquared = (radius / TILE_WIDTH) * (radius / TILE_WIDTH);
+
+	for (I32 chunkY = bottom >> CHUNK_SHIFT; chunkY <= top >> CHUNK_SHIFT; ++chunkY)
+	{
+		I32 firstY = Math::Max(bottom, chunkY << CHUNK_SHIFT);
+		I32 lastY = Math::Min(top, (chunkY << CHUNK_SHIFT) + (I32)CHUNK_MASK);
+
+		for (I32 chunkX = left >> CHUNK_SHIFT; chunkX <= right >> CHUNK_SHIFT; ++chunkX)
+		{
+			I32 chunkLeft = chunkX << CHUNK_SHIFT;
+
+			for (I32 y = firstY; y <= lastY; ++y)
+			{
+				F32 offset = y - centerY;
+				F32 span = radiusSquared - offset * offset;
+				if (span < 0.0f) { continue; }
+
+				F32 halfWidth = Math::Sqrt(span);
+				I32 firstX = Math::Max(chunkLeft, -(I32)Math::Floor(halfWidth - centerX));
+				I32 lastX = Math::Min(chunkLeft + (I32)CHUNK_MASK, (I32)Math::Floor(centerX + halfWidth));
+				firstX = Math::Max(firstX, left);
+				lastX = Math::Min(lastX, right);
+
+				U32 index = TileIndex(firstX, y);
+				for (I32 x = firstX; x <= lastX; ++x, ++index) { func(index, tiles[index]); }
+			}
+		}
+	}
+}
\ No newline at end of file